@@ -1,5 +1,15 @@
 #include <Arduino_FreeRTOS.h>
 
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+
+// Context-switch benchmark instead of the blinking tasks (override with build_flags)
+#ifndef SWITCH_BENCHMARK
+#define SWITCH_BENCHMARK 0
+#endif
+
+#define BENCH_YIELDS 1000  // taskYIELD() calls measured per run
+
 /**
  * @brief Task function to blink LED connected to pin 8 with 1 second period (500ms on, 500ms off)
  * @param pvParameters Pointer to task parameters (unused in this case)
@@ -38,31 +48,114 @@ void TaskBlinkIO9(void *pvParameters) {
   }
 }
 
+#if SWITCH_BENCHMARK
+TaskHandle_t xPeerHandle = NULL;
+
+/**
+ * @brief Benchmark peer - yields straight back to the timing task
+ * @param pvParameters Pointer to task parameters (unused)
+ */
+void TaskYieldPeer(void *pvParameters) {
+  (void) pvParameters;
+
+  while (1) {
+    taskYIELD();
+  }
+}
+
+/**
+ * @brief Benchmark timing task - measures taskYIELD() alone, then with an
+ *        equal-priority peer so that every yield is a context switch
+ * @param pvParameters Pointer to task parameters (unused)
+ */
+void TaskYieldTimer(void *pvParameters) {
+  (void) pvParameters;
+
+  // No other task at this priority: the yield returns without switching
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_YIELDS; i++) {
+    taskYIELD();
+  }
+  uint32_t alone = micros() - start;
+
+  // With the peer ready, each iteration is two switches (here -> peer -> here)
+  vTaskResume(xPeerHandle);
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_YIELDS; i++) {
+    taskYIELD();
+  }
+  uint32_t withPeer = micros() - start;
+  vTaskSuspend(xPeerHandle);
+
+  Serial.println("yields,yield_no_switch_us,context_switch_us");
+  Serial.print(BENCH_YIELDS);
+  Serial.print(',');
+  Serial.print((float) alone / BENCH_YIELDS);
+  Serial.print(',');
+  Serial.println((float) withPeer / (2UL * BENCH_YIELDS));
+  Serial.println("Benchmark complete.");
+
+  vTaskSuspend(NULL);
+}
+#endif
+
 /**
  * @brief Arduino setup function - runs once at startup
  * Initializes and creates FreeRTOS tasks
  */
 void setup() {
+#if HEAP_TRACE || SWITCH_BENCHMARK || SCHED_STATS
+  Serial.begin(9600);  // Heap report / benchmark / scheduler statistics output
+#endif
+
+#if SWITCH_BENCHMARK
+  // Both above the idle task so that nothing else competes for the CPU
+  HEAP_TRACED("YieldTimer", xTaskCreate(
+    TaskYieldTimer, // Task function
+    "YieldTimer",   // Task name (for debugging)
+    192,            // Stack size (float formatting)
+    NULL,           // Task parameters
+    2,              // Task priority
+    NULL            // Task handle
+  ));
+
+  HEAP_TRACED("YieldPeer", xTaskCreate(
+    TaskYieldPeer,  // Task function
+    "YieldPeer",    // Task name (for debugging)
+    128,            // Stack size (bytes in AVR, words in ARM)
+    NULL,           // Task parameters
+    2,              // Same priority as the timing task
+    &xPeerHandle    // Task handle (resumed by the timing task)
+  ));
+  vTaskSuspend(xPeerHandle);
+#else
   // Create task for blinking pin 8
-  xTaskCreate(
+  HEAP_TRACED("Blink8", xTaskCreate(
     TaskBlinkIO8,   // Task function
     "Blink8",       // Task name (for debugging)
     128,            // Stack size (bytes in AVR, words in ARM)
     NULL,           // Task parameters
     1,              // Task priority (higher number = higher priority)
     NULL            // Task handle (not used here)
-  );
+  ));
   
   // Create task for blinking pin 9
-  xTaskCreate(
+  HEAP_TRACED("Blink9", xTaskCreate(
     TaskBlinkIO9,   // Task function
     "Blink9",       // Task name (for debugging)
     128,            // Stack size (bytes in AVR, words in ARM)
     NULL,           // Task parameters
     1,              // Task priority
     NULL            // Task handle
-  );
-  
+  ));
+#endif
+
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 /**
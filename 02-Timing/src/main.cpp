@@ -2,6 +2,10 @@
 
 #include <Arduino_FreeRTOS.h>
 
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+#include <PeriodicTask.h>  // Deadline-miss monitor (../common)
+
 // Pin definitions
 #define LED_DELAY_PIN      8  // vTaskDelay (Red LED)
 #define LED_DELAYUNTIL_PIN 9  // vTaskDelayUntil (Green LED)
@@ -10,6 +14,13 @@
 #define TASK_DELAY_MS     2000
 #define EXECUTION_TIME_MS 100 // Simulated task execution time
 
+// Parameter sweep instead of the two demo tasks (CSV on Serial)
+#ifndef TIMING_SWEEP
+#define TIMING_SWEEP 0
+#endif
+
+#define SWEEP_CYCLES 8 // Periods measured per grid point and method
+
 void TaskDelayDemo(void *pvParameters) {
   (void) pvParameters;
   pinMode(LED_DELAY_PIN, OUTPUT);
@@ -25,9 +36,21 @@ void TaskDelayDemo(void *pvParameters) {
   }
 }
 
+// Report a job that finished after its deadline (runs in the late task)
+void OnDeadlineMiss(PeriodicTask *task, uint32_t responseMicros) {
+  Serial.print("Deadline missed: ");
+  Serial.print(task->name());
+  Serial.print(" (");
+  Serial.print(responseMicros / 1000);
+  Serial.println(" ms)");
+}
+
+// Implicit deadline equal to the period
+PeriodicTask delayUntilPeriodic("vTaskDelayUntil", TASK_DELAY_MS / portTICK_PERIOD_MS, 0, OnDeadlineMiss);
+
 void TaskDelayUntilDemo(void *pvParameters) {
   (void) pvParameters;
-  TickType_t xLastWakeTime = xTaskGetTickCount();
+  delayUntilPeriodic.start();
   pinMode(LED_DELAYUNTIL_PIN, OUTPUT);
   
   for(;;) {
@@ -36,30 +59,206 @@ void TaskDelayUntilDemo(void *pvParameters) {
     // Simulate the same execution time
     vTaskDelay(EXECUTION_TIME_MS / portTICK_PERIOD_MS);
     
-    // Absolute delay - maintains exact period
-    vTaskDelayUntil(&xLastWakeTime, TASK_DELAY_MS / portTICK_PERIOD_MS);
+    // Absolute delay - maintains exact period (xTaskDelayUntil plus response-time tracking)
+    delayUntilPeriodic.waitForNextPeriod();
+  }
+}
+
+#if TIMING_SWEEP
+// Sweep grid: periods are multiples of the 15 ms AVR tick
+static const uint16_t sweepPeriodMs[] = {240, 480, 960};
+static const uint8_t sweepExecPercent[] = {25, 50, 100, 150}; // Execution time, % of period
+static const uint8_t sweepLoadPercent[] = {0, 50};            // CPU demanded by the competing task
+
+#define LOAD_CYCLE_TICKS 10
+
+TaskHandle_t xLoadTask = NULL;
+volatile uint16_t loadBusyMs = 0;    // CPU work per load cycle
+volatile uint32_t loadMsDone = 0;    // CPU work the load has completed
+volatile uint32_t spinCounter = 0;
+uint32_t loopsPerMs = 0;
+
+// Consume CPU for execMs of unloaded run time, so competing load stretches it
+static void Execute(uint16_t execMs) {
+  uint32_t loops = (uint32_t) execMs * loopsPerMs;
+  for (uint32_t i = 0; i < loops; i++) {
+    spinCounter++;
+  }
+}
+
+// Same priority as the measured task: loadBusyMs of calibrated CPU work every
+// LOAD_CYCLE_TICKS. While time-sliced against Execute() the work stretches and
+// the load stays runnable, so it keeps demanding its share of the CPU.
+void TaskLoad(void *pvParameters) {
+  (void) pvParameters;
+
+  for(;;) {
+    TickType_t start = xTaskGetTickCount();
+
+    for (uint16_t ms = loadBusyMs; ms > 0; ms--) {
+      Execute(1);
+      taskENTER_CRITICAL();
+      loadMsDone++;
+      taskEXIT_CRITICAL();
+    }
+
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed < LOAD_CYCLE_TICKS) {
+      vTaskDelay(LOAD_CYCLE_TICKS - elapsed);
+    }
+  }
+}
+
+// CPU milliseconds consumed by the load so far
+static uint32_t LoadMsDone() {
+  taskENTER_CRITICAL();
+  uint32_t done = loadMsDone;
+  taskEXIT_CRITICAL();
+  return done;
+}
+
+// Runs SWEEP_CYCLES periods and prints one CSV row
+static void MeasurePoint(bool delayUntil, uint16_t periodMs, uint16_t execMs, uint8_t loadPercent) {
+  const TickType_t periodTicks = periodMs / portTICK_PERIOD_MS;
+  const uint8_t pin = delayUntil ? LED_DELAYUNTIL_PIN : LED_DELAY_PIN;
+  uint8_t lateCycles = 0;
+
+  uint32_t loadStart = LoadMsDone();
+  TickType_t start = xTaskGetTickCount();
+  TickType_t xLastWakeTime = start;
+  TickType_t last = start;
+
+  for (uint8_t c = 0; c < SWEEP_CYCLES; c++) {
+    digitalWrite(pin, !digitalRead(pin));
+    Execute(execMs);
+
+    if (delayUntil) {
+      xTaskDelayUntil(&xLastWakeTime, periodTicks);
+    } else {
+      vTaskDelay(periodTicks);
+    }
+
+    TickType_t now = xTaskGetTickCount();
+    if ((TickType_t) (now - last) > periodTicks) {
+      lateCycles++;
+    }
+    last = now;
   }
+
+  uint32_t elapsedMs = (uint32_t) (TickType_t) (last - start) * portTICK_PERIOD_MS;
+  uint32_t loadMs = LoadMsDone() - loadStart;
+
+  Serial.print(delayUntil ? "vTaskDelayUntil," : "vTaskDelay,");
+  Serial.print(periodMs);
+  Serial.print(',');
+  Serial.print(execMs);
+  Serial.print(',');
+  Serial.print(loadPercent);
+  Serial.print(',');
+  Serial.print(SWEEP_CYCLES);
+  Serial.print(',');
+  Serial.print((float) elapsedMs / SWEEP_CYCLES, 1);
+  Serial.print(',');
+  Serial.print((long) elapsedMs - (long) SWEEP_CYCLES * periodMs);
+  Serial.print(',');
+  Serial.print(lateCycles);
+  Serial.print(',');
+  Serial.println(elapsedMs ? loadMs * 100 / elapsedMs : 0);
 }
 
+void TaskSweep(void *pvParameters) {
+  (void) pvParameters;
+  pinMode(LED_DELAY_PIN, OUTPUT);
+  pinMode(LED_DELAYUNTIL_PIN, OUTPUT);
+
+  // Calibrate Execute() while nothing else is runnable: double the loop count
+  // until it spans at least 16 ticks
+  vTaskDelay(1);
+  for (uint32_t loops = 1000; loopsPerMs == 0; loops *= 2) {
+    TickType_t start = xTaskGetTickCount();
+    for (uint32_t i = 0; i < loops; i++) {
+      spinCounter++;
+    }
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= 16) {
+      loopsPerMs = loops / ((uint32_t) elapsed * portTICK_PERIOD_MS);
+    }
+  }
+
+  Serial.println("method,period_ms,exec_ms,load_pct,cycles,avg_period_ms,drift_ms,late_cycles,load_cpu_pct");
+
+  for (uint8_t l = 0; l < sizeof(sweepLoadPercent); l++) {
+    loadBusyMs = (uint16_t) sweepLoadPercent[l] * LOAD_CYCLE_TICKS * portTICK_PERIOD_MS / 100;
+    if (loadBusyMs > 0) {
+      vTaskResume(xLoadTask);
+    }
+
+    for (uint8_t p = 0; p < sizeof(sweepPeriodMs) / sizeof(sweepPeriodMs[0]); p++) {
+      for (uint8_t e = 0; e < sizeof(sweepExecPercent); e++) {
+        uint16_t execMs = (uint32_t) sweepPeriodMs[p] * sweepExecPercent[e] / 100;
+        MeasurePoint(false, sweepPeriodMs[p], execMs, sweepLoadPercent[l]);
+        MeasurePoint(true, sweepPeriodMs[p], execMs, sweepLoadPercent[l]);
+      }
+    }
+
+    vTaskSuspend(xLoadTask);
+  }
+
+  Serial.println("Sweep complete.");
+  vTaskSuspend(NULL);
+}
+#endif
+
 void setup() {
+  Serial.begin(9600);  // Deadline misses, heap report and sweep output
+
+#if TIMING_SWEEP
+  HEAP_TRACED("Sweep", xTaskCreate(
+    TaskSweep,
+    "Sweep",
+    192,
+    NULL,
+    1,
+    NULL
+  ));
+
+  // Created suspended; resumed for grid points with competing load
+  HEAP_TRACED("Load", xTaskCreate(
+    TaskLoad,
+    "Load",
+    96,
+    NULL,
+    1,
+    &xLoadTask
+  ));
+  vTaskSuspend(xLoadTask);
+#else
   // Create both tasks with same priority
-  xTaskCreate(
+  HEAP_TRACED("vTaskDelay", xTaskCreate(
     TaskDelayDemo,
     "vTaskDelay",
     128,
     NULL,
     1,
     NULL
-  );
+  ));
   
-  xTaskCreate(
+  HEAP_TRACED("vTaskDelayUntil", xTaskCreate(
     TaskDelayUntilDemo,
     "vTaskDelayUntil",
-    128,
+    192,  // The deadline-miss hook prints 32-bit values from this task
     NULL,
     1,
     NULL
-  );
+  ));
+#endif
+
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 void loop() {}
\ No newline at end of file
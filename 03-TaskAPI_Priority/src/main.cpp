@@ -2,6 +2,11 @@
 #include <Arduino_FreeRTOS.h>
 #include <task.h>
 
+#include <PortDebouncer.h>  // Shared port debouncer (../common)
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+#include <BootTimer.h>  // Fast boot and boot-time measurement (../common)
+
 // Pin definitions
 #define LED_GREEN      9
 #define LED_RED        8
@@ -9,6 +14,14 @@
 #define BUTTON_START   3
 #define BUTTON_STOP    4
 
+// Button bits on PORTD (UNO pins 2-4 are PD2-PD4)
+#define BUTTON_EMERG_BIT  (1 << 2)
+#define BUTTON_START_BIT  (1 << 3)
+#define BUTTON_STOP_BIT   (1 << 4)
+#define BUTTON_PORT_MASK  (BUTTON_EMERG_BIT | BUTTON_START_BIT | BUTTON_STOP_BIT)
+
+#define DEBOUNCE_PERIOD   pdMS_TO_TICKS(15)  // Port sampling period
+
 // Global state flags (volatile since accessed in multiple tasks)
 volatile bool emergency = false;
 volatile bool systemStarted = false;
@@ -16,6 +29,26 @@ volatile bool systemStarted = false;
 // Handle for the blinking task to suspend/resume it
 TaskHandle_t xHandleBlink = NULL;
 
+// Handles of the button tasks, notified of debounced edges
+TaskHandle_t xHandleEmergency = NULL;
+TaskHandle_t xHandleStart = NULL;
+TaskHandle_t xHandleStop = NULL;
+
+/**
+ * @brief Read all three buttons in one port access
+ */
+static uint8_t ReadButtonPort() {
+#if defined(__AVR__)
+  return PIND;
+#else
+  // Other boards: assemble the same bit layout from the individual pins
+  return (digitalRead(BUTTON_EMERG) << 2) | (digitalRead(BUTTON_START) << 3) | (digitalRead(BUTTON_STOP) << 4);
+#endif
+}
+
+// One debouncer for all buttons (active low, internal pull-ups)
+PortDebouncer buttons(ReadButtonPort, BUTTON_PORT_MASK, BUTTON_PORT_MASK);
+
 /**
  * @brief Task function to blink the green LED every 500 ms (500 ms ON, 500 ms OFF)
  * @param pvParameters Pointer to task parameters (unused)
@@ -43,24 +76,27 @@ void TaskBlink(void *pvParameters) {
  */
 void TaskEmergency(void *pvParameters) {
   (void) pvParameters;
-  
-  // Initialize emergency button input with internal pull-up resistor
-  pinMode(BUTTON_EMERG, INPUT_PULLUP);
+
+  BOOT_MARK_FIRST_TASK();  // Boot-critical task: highest priority
   
   // Initialize red LED pin as output
   pinMode(LED_RED, OUTPUT);
   
   // Infinite task loop
   while (1) {
-    // Check if emergency button pressed (active low) and emergency not already triggered
-    if (digitalRead(BUTTON_EMERG) == LOW && !emergency) {
+    uint32_t events = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY);  // Wait for a debounced edge
+
+    // Check if emergency button pressed and emergency not already triggered
+    if ((PortDebouncer::pressed(events) & BUTTON_EMERG_BIT) && !emergency) {
       emergency = true;                      // Set emergency flag
       digitalWrite(LED_RED, HIGH);          // Turn red LED ON
       digitalWrite(LED_GREEN, LOW);         // Ensure green LED is OFF
-      vTaskSuspend(xHandleBlink);           // Suspend the green LED blinking task
+      if (xHandleBlink != NULL) {           // NULL until the fast-boot task creates it
+        vTaskSuspend(xHandleBlink);         // Suspend the green LED blinking task
+      }
       Serial.println("🛑 EMERGENCY ACTIVATED");
     }
-    vTaskDelay(50 / portTICK_PERIOD_MS);    // Poll button every 50 ms
   }
 }
 
@@ -72,17 +108,16 @@ void TaskEmergency(void *pvParameters) {
 void TaskStart(void *pvParameters) {
   (void) pvParameters;
   
-  // Initialize start button input with internal pull-up resistor
-  pinMode(BUTTON_START, INPUT_PULLUP);
-  
   // Infinite task loop
   while (1) {
-    if (digitalRead(BUTTON_START) == LOW && !emergency && !systemStarted) {
+    uint32_t events = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY);  // Wait for a debounced edge
+
+    if ((PortDebouncer::pressed(events) & BUTTON_START_BIT) && !emergency && !systemStarted && xHandleBlink != NULL) {
       systemStarted = true;                  // Set system started flag
       vTaskResume(xHandleBlink);             // Resume blinking task
       Serial.println("✅ SYSTEM STARTED");
     }
-    vTaskDelay(50 / portTICK_PERIOD_MS);    // Poll button every 50 ms
   }
 }
 
@@ -94,73 +129,120 @@ void TaskStart(void *pvParameters) {
 void TaskStop(void *pvParameters) {
   (void) pvParameters;
   
-  // Initialize stop button input with internal pull-up resistor
-  pinMode(BUTTON_STOP, INPUT_PULLUP);
-  
   // Infinite task loop
   while (1) {
-    if (digitalRead(BUTTON_STOP) == LOW && !emergency && systemStarted) {
+    uint32_t events = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY);  // Wait for a debounced edge
+
+    if ((PortDebouncer::pressed(events) & BUTTON_STOP_BIT) && !emergency && systemStarted) {
       digitalWrite(LED_GREEN, LOW);          // Turn green LED OFF
       vTaskSuspend(xHandleBlink);             // Suspend blinking task
       systemStarted = false;                   // Reset system started flag
       Serial.println("⏹️ SYSTEM STOPPED");
     }
-    vTaskDelay(50 / portTICK_PERIOD_MS);      // Poll button every 50 ms
   }
 }
 
+/**
+ * @brief Create the green LED blinking task
+ */
+static void CreateBlinkTask() {
+  HEAP_TRACED("Blink", xTaskCreate(
+    TaskBlink,           // Task function pointer
+    "Blink",             // Task name for debugging
+    128,                 // Stack size (in words, depends on architecture)
+    NULL,                // Parameters to pass to the task
+    1,                   // Task priority (1 = low)
+    &xHandleBlink        // Task handle (used for suspend/resume)
+  ));
+}
+
+/**
+ * @brief Non-critical start-up: runs at the end of setup(), or after the
+ *        control tasks have started in a fast boot
+ */
+static void StartupDeferred() {
+#if FAST_BOOT
+  // The blink task starts suspended anyway, so it is created off the boot path.
+  // The scheduler is held so it cannot run between creation and suspension.
+  vTaskSuspendAll();
+  CreateBlinkTask();
+  vTaskSuspend(xHandleBlink);
+  xTaskResumeAll();
+#endif
+
+  Serial.println("PriorityTaskAPI Control RTOS Starting...");
+}
+
 /**
  * @brief Arduino setup function - initializes serial communication, creates FreeRTOS tasks,
  *        and suspends blinking task initially.
  */
 void setup() {
   Serial.begin(9600);
+#if !FAST_BOOT
   while (!Serial); // Wait for Serial to be ready
+#endif
   
+  // Initialize button inputs with internal pull-up resistors
+  pinMode(BUTTON_EMERG, INPUT_PULLUP);
+  pinMode(BUTTON_START, INPUT_PULLUP);
+  pinMode(BUTTON_STOP, INPUT_PULLUP);
+  
+#if !FAST_BOOT
   // Create task to blink green LED with low priority
-  xTaskCreate(
-    TaskBlink,           // Task function pointer
-    "Blink",             // Task name for debugging
-    128,                 // Stack size (in words, depends on architecture)
-    NULL,                // Parameters to pass to the task
-    1,                   // Task priority (1 = low)
-    &xHandleBlink        // Task handle (used for suspend/resume)
-  );
+  CreateBlinkTask();
+#endif
   
   // Create emergency button monitoring task with highest priority
-  xTaskCreate(
+  HEAP_TRACED("Emergency", xTaskCreate(
     TaskEmergency,       // Task function pointer
     "Emergency",         // Task name for debugging
     96,                  // Stack size
     NULL,                // Parameters
     3,                   // Highest priority
-    NULL                 // No task handle needed
-  );
+    &xHandleEmergency    // Notified by the debouncer
+  ));
   
   // Create start button monitoring task with medium priority
-  xTaskCreate(
+  HEAP_TRACED("Start", xTaskCreate(
     TaskStart,           // Task function pointer
     "Start",             // Task name
     96,                  // Stack size
     NULL,                // Parameters
     2,                   // Medium priority
-    NULL                 // No task handle needed
-  );
+    &xHandleStart        // Notified by the debouncer
+  ));
   
   // Create stop button monitoring task with medium priority
-  xTaskCreate(
+  HEAP_TRACED("Stop", xTaskCreate(
     TaskStop,            // Task function pointer
     "Stop",              // Task name
     96,                  // Stack size
     NULL,                // Parameters
     2,                   // Medium priority
-    NULL                 // No task handle needed
-  );
+    &xHandleStop         // Notified by the debouncer
+  ));
   
-  Serial.println("PriorityTaskAPI Control RTOS Starting...");
+  // Sample all buttons together at the emergency task's priority so sampling stays periodic
+  buttons.subscribe(xHandleEmergency, BUTTON_EMERG_BIT);
+  buttons.subscribe(xHandleStart, BUTTON_START_BIT);
+  buttons.subscribe(xHandleStop, BUTTON_STOP_BIT);
+  buttons.begin(DEBOUNCE_PERIOD, 3);
   
+  BOOT_DEFER(StartupDeferred);
+
+#if !FAST_BOOT
   // Initially suspend blinking task until started
   vTaskSuspend(xHandleBlink);
+#endif
+
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 /**
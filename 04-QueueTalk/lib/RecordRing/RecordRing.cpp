@@ -0,0 +1,96 @@
+#include "RecordRing.h"
+
+#include <stddef.h>
+
+// Keep the compiler from moving payload accesses across index updates
+#define RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+RecordRing::RecordRing(uint8_t *storage, uint8_t size)
+  : buffer(storage), size(size), head(0), tail(0), reservedAt(0), wrapPending(false) {
+  // With (length + 1) <= (size - 1) / 2, an empty ring at any offset has room
+  // either before the end of the buffer or, after wrapping, before the tail
+  uint8_t limit = (size - 1) / 2 - 1;
+  maxLength = limit < MAX_RECORD ? limit : MAX_RECORD;
+}
+
+uint8_t *RecordRing::reserve(uint8_t length) {
+  if (length == 0 || length > maxLength) {
+    return NULL;
+  }
+
+  uint8_t total = length + 1;  // Length prefix + payload
+  uint8_t h = head;
+  uint8_t t = tail;
+
+  if (h >= t) {
+    uint8_t room = size - h;
+
+    // Fits before the end; landing exactly on the end wraps head to 0,
+    // which must not catch up with the reader
+    if (total < room || (total == room && t != 0)) {
+      reservedAt = h;
+      wrapPending = false;
+      return &buffer[h + 1];
+    }
+
+    // Otherwise restart at offset 0, keeping one byte between head and tail
+    if (total < t) {
+      reservedAt = 0;
+      wrapPending = true;
+      return &buffer[1];
+    }
+  } else if (total < t - h) {
+    reservedAt = h;
+    wrapPending = false;
+    return &buffer[h + 1];
+  }
+
+  return NULL;
+}
+
+void RecordRing::commit(uint8_t length) {
+  buffer[reservedAt] = length;
+
+  if (wrapPending) {
+    buffer[head] = 0;  // Tell the reader to skip to offset 0
+  }
+
+  uint8_t next = reservedAt + length + 1;
+  if (next == size) {
+    next = 0;
+  }
+
+  RING_BARRIER();
+  head = next;
+}
+
+const uint8_t *RecordRing::peek(uint8_t *length) {
+  uint8_t t = tail;
+  if (t == head) {
+    return NULL;
+  }
+  RING_BARRIER();
+
+  if (buffer[t] == 0) {
+    // Wrap marker: the next record starts at offset 0
+    t = 0;
+    tail = 0;
+    if (t == head) {
+      return NULL;
+    }
+    RING_BARRIER();
+  }
+
+  *length = buffer[t];
+  return &buffer[t + 1];
+}
+
+void RecordRing::release() {
+  uint8_t next = tail + buffer[tail] + 1;
+  if (next == size) {
+    next = 0;
+  }
+
+  RING_BARRIER();
+  tail = next;
+}
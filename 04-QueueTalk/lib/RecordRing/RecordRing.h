@@ -0,0 +1,73 @@
+#ifndef RECORD_RING_H
+#define RECORD_RING_H
+
+#include <stdint.h>
+
+/**
+ * @brief Single-producer / single-consumer ring of variable-length records.
+ *
+ * Each record is stored contiguously as a one-byte length prefix followed by
+ * its payload, so both sides work directly on the ring memory:
+ *   - the producer reserve()s space, writes the payload in place and commit()s it
+ *   - the consumer peek()s at the oldest record in place and release()s it
+ *
+ * A zero length prefix marks unused space at the end of the buffer; the reader
+ * skips it and continues at offset 0. Indices are 8-bit so that publishing them
+ * is a single atomic store on AVR, which limits the ring to 255 bytes.
+ */
+class RecordRing {
+public:
+  static const uint8_t MAX_RECORD = 64;  // Largest payload accepted by reserve()
+
+  // Smallest ring in which a MAX_RECORD payload fits whatever the empty ring's offset
+  static const uint8_t MIN_SIZE = 2 * (MAX_RECORD + 1) + 1;
+
+  /**
+   * @param storage Backing buffer, owned by the caller
+   * @param size    Buffer size in bytes (at most 255). Below MIN_SIZE the
+   *                largest payload is reduced to maxRecord().
+   */
+  RecordRing(uint8_t *storage, uint8_t size);
+
+  /**
+   * @brief Largest payload reserve() accepts. A record of this size always
+   *        fits once the consumer has drained the ring, so a producer that
+   *        retries reserve() cannot wait forever.
+   */
+  uint8_t maxRecord() const { return maxLength; }
+
+  /**
+   * @brief Reserve contiguous space for a payload of up to @p length bytes.
+   * @return Pointer to write the payload to, or NULL if the ring is too full
+   */
+  uint8_t *reserve(uint8_t length);
+
+  /**
+   * @brief Publish the record written after the last successful reserve().
+   * @param length Actual payload length (1 .. reserved length)
+   */
+  void commit(uint8_t length);
+
+  /**
+   * @brief Access the oldest record without copying it.
+   * @param length Receives the payload length
+   * @return Pointer to the payload, or NULL if the ring is empty
+   */
+  const uint8_t *peek(uint8_t *length);
+
+  /**
+   * @brief Discard the record returned by the last peek().
+   */
+  void release();
+
+private:
+  uint8_t *buffer;
+  uint8_t size;
+  uint8_t maxLength;      // Payload limit, see maxRecord()
+  volatile uint8_t head;  // Next write offset, only modified by the producer
+  volatile uint8_t tail;  // Oldest record offset, only modified by the consumer
+  uint8_t reservedAt;     // Offset of the pending record's length prefix
+  bool wrapPending;       // Pending record starts at offset 0
+};
+
+#endif
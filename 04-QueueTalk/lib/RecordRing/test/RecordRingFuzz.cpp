@@ -0,0 +1,76 @@
+/*
+ * Host-side fuzz check for RecordRing (not part of the firmware build).
+ *
+ *   g++ -O2 -I.. RecordRingFuzz.cpp ../RecordRing.cpp -o /tmp/ringfuzz && /tmp/ringfuzz
+ *
+ * Random reserve/commit/peek/release sequences are checked against a FIFO
+ * model for every ring size. Whenever the ring is empty, a maxRecord()
+ * reservation must succeed.
+ */
+#include "RecordRing.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <deque>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+  if (!(cond)) { printf("size %u: ", size); printf(__VA_ARGS__); printf("\n"); failures++; return; } \
+} while (0)
+
+static void Fuzz(unsigned size, unsigned seed) {
+  std::vector<uint8_t> storage(size);
+  RecordRing ring(storage.data(), (uint8_t) size);
+  std::deque<std::vector<uint8_t> > model;
+  uint8_t maxLength = ring.maxRecord();
+
+  CHECK(maxLength >= 1, "no usable record length");
+  CHECK(size < RecordRing::MIN_SIZE || maxLength == RecordRing::MAX_RECORD, "maxRecord %u below MAX_RECORD", maxLength);
+  srand(seed);
+
+  for (unsigned step = 0; step < 200000; step++) {
+    if (model.empty()) {
+      uint8_t *record = ring.reserve(maxLength);
+      CHECK(record != NULL, "empty ring refused %u bytes at step %u", maxLength, step);
+    }
+
+    if (rand() % 2) {
+      uint8_t want = 1 + rand() % maxLength;
+      uint8_t *record = ring.reserve(want);
+      if (record != NULL) {
+        uint8_t length = 1 + rand() % want;
+        std::vector<uint8_t> payload(length);
+        for (uint8_t i = 0; i < length; i++) {
+          payload[i] = (uint8_t) rand();
+        }
+        memcpy(record, payload.data(), length);
+        ring.commit(length);
+        model.push_back(payload);
+      }
+    } else {
+      uint8_t length = 0;
+      const uint8_t *record = ring.peek(&length);
+      if (model.empty()) {
+        CHECK(record == NULL, "peek on empty ring returned a record at step %u", step);
+      } else {
+        CHECK(record != NULL, "peek lost a record at step %u", step);
+        CHECK(length == model.front().size() && memcmp(record, model.front().data(), length) == 0,
+              "record corrupted at step %u", step);
+        ring.release();
+        model.pop_front();
+      }
+    }
+  }
+}
+
+int main() {
+  for (unsigned size = 5; size <= 255; size++) {
+    Fuzz(size, size);
+  }
+
+  printf(failures ? "RecordRing fuzz: %d failures\n" : "RecordRing fuzz: ok\n", failures);
+  return failures ? 1 : 0;
+}
@@ -3,13 +3,109 @@
 #include <Arduino_FreeRTOS.h>
 #include <queue.h>  // Required for using FreeRTOS queues
 
+#include "RecordRing.h"  // Variable-length in-place transport (lib/RecordRing)
+#include <PortDebouncer.h>  // Shared port debouncer (../common)
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+#include <BootTimer.h>  // Fast boot and boot-time measurement (../common)
+
 // Pin definitions
 #define BUTTON_PIN 2
 #define LED_PIN    8
 
+#define BUTTON_BIT      (1 << 2)           // UNO pin 2 is PD2
+#define DEBOUNCE_PERIOD pdMS_TO_TICKS(15)  // Port sampling period
+
+// Queue geometry
+#define QUEUE_LENGTH 5  // Number of messages the queue can hold
+#define MESSAGE_SIZE 4  // "ON"/"OFF" plus terminator
+
+// Consumer mode (override with build_flags in platformio.ini)
+// 0 = one message per wake-up, 1 = drain the queue and apply only the final state
+#ifndef QUEUE_BATCH_DRAIN
+#define QUEUE_BATCH_DRAIN 0
+#endif
+
+// Throughput benchmark instead of the button demo
+#ifndef QUEUE_BENCHMARK
+#define QUEUE_BENCHMARK 0
+#endif
+
+#define BENCH_MESSAGES 1000  // Messages sent per queue depth
+
+// Transport (override with build_flags in platformio.ini)
+// 0 = fixed-size FreeRTOS queue, 1 = variable-length records read in place
+#ifndef QUEUE_TRANSPORT_RING
+#define QUEUE_TRANSPORT_RING 0
+#endif
+
+#define RING_SIZE 132  // Ring bytes shared by all records (vs. 5 x 65 worst-case queue slots)
+
+#if QUEUE_TRANSPORT_RING && QUEUE_BENCHMARK
+#error "The throughput benchmark only measures the queue transport"
+#endif
+
 // Declare a handle for the queue
 QueueHandle_t xQueue = NULL;
 
+#if QUEUE_TRANSPORT_RING
+// Length-prefixed records, written and read in place
+static uint8_t ringStorage[RING_SIZE];
+RecordRing xRing(ringStorage, RING_SIZE);
+
+// Smaller rings lower the largest payload; see RecordRing::maxRecord()
+static_assert(RING_SIZE >= RecordRing::MIN_SIZE, "RING_SIZE too small for 64-byte records");
+#endif
+
+// Handle of the LED task, notified when records are committed to the ring
+TaskHandle_t xLedTask = NULL;
+
+// Handle of the button task, notified of debounced edges
+TaskHandle_t xButtonTask = NULL;
+
+/**
+ * @brief Read the button port in one access
+ */
+static uint8_t ReadButtonPort() {
+#if defined(__AVR__)
+  return PIND;
+#else
+  // Other boards: assemble the same bit layout from the individual pins
+  return digitalRead(BUTTON_PIN) << 2;
+#endif
+}
+
+// Button pulls pin 2 HIGH when pressed (external wiring, no pull-up)
+PortDebouncer buttons(ReadButtonPort, BUTTON_BIT, 0);
+
+/**
+ * @brief Decode an "ON"/"OFF" message into an LED level
+ * @param message Message bytes (not necessarily null-terminated)
+ * @param length  Number of message bytes
+ * @return HIGH, LOW, or -1 for an unknown message
+ */
+static int MessageLevel(const char *message, uint8_t length) {
+  if (length == 2 && memcmp(message, "ON", 2) == 0) {
+    return HIGH;
+  }
+  if (length == 3 && memcmp(message, "OFF", 3) == 0) {
+    return LOW;
+  }
+  return -1;
+}
+
+/**
+ * @brief Drive the LED from an "ON"/"OFF" message
+ * @param message Message bytes received from the transport
+ * @param length  Number of message bytes
+ */
+static void ApplyMessage(const char *message, uint8_t length) {
+  int level = MessageLevel(message, length);
+  if (level >= 0) {
+    digitalWrite(LED_PIN, level);
+  }
+}
+
 /**
  * @brief Task function to read button state and send "ON"/"OFF" messages
  * @param pvParameters Pointer to task parameters (unused in this case)
@@ -17,15 +113,35 @@ QueueHandle_t xQueue = NULL;
 void TaskButton(void *pvParameters) {
   (void) pvParameters;  // Explicitly cast unused parameter to void
 
+  BOOT_MARK_FIRST_TASK();  // Boot-critical task: start of the button -> LED path
+
   int lastState = LOW;  // Store last button state
 
   // Infinite task loop
   while (1) {
-    int currentState = digitalRead(BUTTON_PIN);
+    // Wait for a debounced edge, then act on the settled button level
+    xTaskNotifyWait(0, 0xFFFFFFFF, NULL, portMAX_DELAY);
+    int currentState = (buttons.state() & BUTTON_BIT) ? HIGH : LOW;
 
     // Detect state change
     if (currentState != lastState) {
-      char message[4];
+#if QUEUE_TRANSPORT_RING
+      const char *message = (currentState == HIGH) ? "ON" : "OFF";
+      uint8_t length = strlen(message);
+
+      // Reserve space in the ring and write the record in place
+      uint8_t *record;
+      while ((record = xRing.reserve(length)) == NULL) {
+        vTaskDelay(1);  // Ring full, let the LED task release records
+      }
+      memcpy(record, message, length);
+      xRing.commit(length);
+      xTaskNotifyGive(xLedTask);
+
+      Serial.print("Sent: ");
+      Serial.println(message);
+#else
+      char message[MESSAGE_SIZE];
 
       if (currentState == HIGH) {
         strcpy(message, "ON");
@@ -38,11 +154,10 @@ void TaskButton(void *pvParameters) {
         Serial.print("Sent: ");
         Serial.println(message);
       }
+#endif
 
       lastState = currentState;  // Update last state
     }
-
-    vTaskDelay(50 / portTICK_PERIOD_MS);  // Debounce delay
   }
 }
 
@@ -53,25 +168,194 @@ void TaskButton(void *pvParameters) {
 void TaskLED(void *pvParameters) {
   (void) pvParameters;  // Explicitly cast unused parameter to void
 
-  char receivedMessage[4];  // Buffer to hold received string
+#if QUEUE_TRANSPORT_RING
+  // Infinite task loop
+  while (1) {
+    // Wait until the button task has committed at least one record
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    const uint8_t *record;
+    uint8_t length;
+    int finalLevel = -1;
+
+    // Read every pending record directly from the ring
+    while ((record = xRing.peek(&length)) != NULL) {
+      Serial.print("Received: ");
+      Serial.write(record, length);
+      Serial.println();
+
+#if QUEUE_BATCH_DRAIN
+      int level = MessageLevel((const char *) record, length);
+      if (level >= 0) {
+        finalLevel = level;  // Only the newest state is applied
+      }
+#else
+      ApplyMessage((const char *) record, length);
+#endif
+
+      xRing.release();
+    }
+
+    if (finalLevel >= 0) {
+      digitalWrite(LED_PIN, finalLevel);
+    }
+  }
+#else
+  char receivedMessage[MESSAGE_SIZE];  // Buffer to hold received string
 
   // Infinite task loop
   while (1) {
     // Wait indefinitely for a message from the queue
     if (xQueueReceive(xQueue, receivedMessage, portMAX_DELAY) == pdPASS) {
+#if QUEUE_BATCH_DRAIN
+      // Drain everything already queued; each message carries the full LED
+      // state, so only the newest one needs to be applied
+      UBaseType_t drained = 1;
+      while (xQueueReceive(xQueue, receivedMessage, 0) == pdPASS) {
+        drained++;
+      }
+
+      Serial.print("Received ");
+      Serial.print(drained);
+      Serial.print(" message(s), applied: ");
+      Serial.println(receivedMessage);
+#else
       Serial.print("Received: ");
       Serial.println(receivedMessage);
+#endif
 
       // Control LED based on message
-      if (strcmp(receivedMessage, "ON") == 0) {
-        digitalWrite(LED_PIN, HIGH);
-      } else if (strcmp(receivedMessage, "OFF") == 0) {
-        digitalWrite(LED_PIN, LOW);
+      ApplyMessage(receivedMessage, strlen(receivedMessage));
+    }
+  }
+#endif
+}
+
+#if QUEUE_BENCHMARK
+// Depths swept by the benchmark
+static const UBaseType_t benchDepths[] = {1, 2, 5, 10};
+
+// Messages sized to a full queue slot so every send copies initialised bytes
+static const char benchMessages[3][MESSAGE_SIZE] = {"ON", "OFF", "END"};
+
+// Consumer-side counters, reset by the producer before each run
+volatile uint32_t benchWakeups = 0;     // Times the consumer had to block on an empty queue
+volatile uint32_t benchLedUpdates = 0;  // Times the LED state was actually applied
+
+TaskHandle_t xBenchProducer = NULL;
+TaskHandle_t xBenchConsumer = NULL;
+
+/**
+ * @brief Benchmark consumer - same receive strategy as TaskLED, without Serial output.
+ *        An "END" message closes a run and hands control back to the producer.
+ * @param pvParameters Pointer to task parameters (unused)
+ */
+void TaskBenchConsumer(void *pvParameters) {
+  (void) pvParameters;
+
+  char receivedMessage[MESSAGE_SIZE];
+
+  while (1) {
+    // Wait for the producer to create the queue for the next run
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    bool running = true;
+    while (running) {
+      if (uxQueueMessagesWaiting(xQueue) == 0) {
+        benchWakeups++;
+      }
+
+      if (xQueueReceive(xQueue, receivedMessage, portMAX_DELAY) != pdPASS) {
+        continue;
+      }
+
+#if QUEUE_BATCH_DRAIN
+      char nextMessage[MESSAGE_SIZE];
+      while (receivedMessage[0] != 'E' && xQueueReceive(xQueue, nextMessage, 0) == pdPASS) {
+        memcpy(receivedMessage, nextMessage, MESSAGE_SIZE);
+      }
+#endif
+
+      if (receivedMessage[0] == 'E') {
+        running = false;
+      } else {
+        ApplyMessage(receivedMessage, strlen(receivedMessage));
+        benchLedUpdates++;
       }
     }
+
+    xTaskNotifyGive(xBenchProducer);
   }
 }
 
+/**
+ * @brief Benchmark producer - sends BENCH_MESSAGES alternating "ON"/"OFF" messages
+ *        as fast as possible for each queue depth and prints one CSV row per depth.
+ * @param pvParameters Pointer to task parameters (unused)
+ */
+void TaskBenchProducer(void *pvParameters) {
+  (void) pvParameters;
+
+  Serial.println("mode,depth,messages,msgs_per_s,producer_block_us,queue_full_events,consumer_wakeups,led_updates");
+
+  for (uint8_t d = 0; d < sizeof(benchDepths) / sizeof(benchDepths[0]); d++) {
+    xQueue = xQueueCreate(benchDepths[d], MESSAGE_SIZE);
+    if (xQueue == NULL) {
+      Serial.println("Error creating the queue.");
+      break;
+    }
+
+    benchWakeups = 0;
+    benchLedUpdates = 0;
+    uint32_t blockedMicros = 0;
+    uint32_t fullEvents = 0;
+
+    xTaskNotifyGive(xBenchConsumer);
+
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < BENCH_MESSAGES; i++) {
+      const char *message = benchMessages[i & 1];
+
+      if (uxQueueSpacesAvailable(xQueue) == 0) {
+        // Queue full: this send will block until the consumer makes room
+        fullEvents++;
+        uint32_t blockStart = micros();
+        xQueueSend(xQueue, message, portMAX_DELAY);
+        blockedMicros += micros() - blockStart;
+      } else {
+        xQueueSend(xQueue, message, portMAX_DELAY);
+      }
+    }
+    uint32_t elapsed = micros() - start;
+
+    // Close the run and wait until the consumer has drained the queue
+    xQueueSend(xQueue, benchMessages[2], portMAX_DELAY);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    Serial.print(QUEUE_BATCH_DRAIN ? "batched," : "single,");
+    Serial.print(benchDepths[d]);
+    Serial.print(',');
+    Serial.print(BENCH_MESSAGES);
+    Serial.print(',');
+    Serial.print((uint32_t) BENCH_MESSAGES * 1000000UL / elapsed);
+    Serial.print(',');
+    Serial.print(blockedMicros);
+    Serial.print(',');
+    Serial.print(fullEvents);
+    Serial.print(',');
+    Serial.print(benchWakeups);
+    Serial.print(',');
+    Serial.println(benchLedUpdates);
+
+    vQueueDelete(xQueue);
+    xQueue = NULL;
+  }
+
+  Serial.println("Benchmark complete.");
+  vTaskSuspend(NULL);
+}
+#endif
+
 /**
  * @brief Arduino setup function - runs once at startup
  * Initializes pins, queue, and creates FreeRTOS tasks
@@ -79,40 +363,77 @@ void TaskLED(void *pvParameters) {
 void setup() {
   // Initialize serial communication
   Serial.begin(9600);
+#if !FAST_BOOT
   while (!Serial);  // Wait for Serial to be ready (for boards like Leonardo)
+#endif
 
   // Configure I/O pins
   pinMode(BUTTON_PIN, INPUT);
   pinMode(LED_PIN, OUTPUT);
 
+#if QUEUE_BENCHMARK
+  // Producer and consumer share a priority, as ButtonTask and LEDTask do
+  HEAP_TRACED("BenchProducer", xTaskCreate(
+    TaskBenchProducer,  // Task function
+    "BenchProducer",    // Task name
+    192,                // Stack size (Serial output of 32-bit counters)
+    NULL,               // Task parameters
+    1,                  // Priority
+    &xBenchProducer     // Task handle (notified by the consumer)
+  ));
+
+  HEAP_TRACED("BenchConsumer", xTaskCreate(
+    TaskBenchConsumer,  // Task function
+    "BenchConsumer",    // Task name
+    128,                // Stack size
+    NULL,               // Task parameters
+    1,                  // Priority
+    &xBenchConsumer     // Task handle (notified by the producer)
+  ));
+#else
+#if !QUEUE_TRANSPORT_RING
   // Create a queue that can hold 5 string messages (up to 4 chars each)
-  xQueue = xQueueCreate(5, sizeof(char) * 4);
+  xQueue = HEAP_TRACED("xQueue", xQueueCreate(QUEUE_LENGTH, sizeof(char) * MESSAGE_SIZE));
 
   // Check if queue was created successfully
   if (xQueue == NULL) {
     Serial.println("Error creating the queue.");
     while (1);  // Halt execution
   }
+#endif
 
   // Create the button task
-  xTaskCreate(
+  HEAP_TRACED("ButtonTask", xTaskCreate(
     TaskButton,     // Task function
     "ButtonTask",   // Task name
     128,            // Stack size
     NULL,           // Task parameters
     1,              // Priority
-    NULL            // Task handle
-  );
+    &xButtonTask    // Task handle (notified by the debouncer)
+  ));
 
   // Create the LED task
-  xTaskCreate(
+  HEAP_TRACED("LEDTask", xTaskCreate(
     TaskLED,        // Task function
     "LEDTask",      // Task name
     128,            // Stack size
     NULL,           // Task parameters
     1,              // Priority
-    NULL            // Task handle
-  );
+    &xLedTask       // Task handle (notified by the ring transport)
+  ));
+
+  // Sample the button port above the application tasks
+  buttons.subscribe(xButtonTask, BUTTON_BIT);
+  buttons.begin(DEBOUNCE_PERIOD, 2);
+#endif
+
+  BOOT_DEFER(NULL);
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 /**
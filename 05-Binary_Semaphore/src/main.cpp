@@ -2,13 +2,55 @@
 #include <Arduino_FreeRTOS.h>
 #include <semphr.h>  // Required for using FreeRTOS semaphores
 
+#include <PortDebouncer.h>  // Shared port debouncer (../common)
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+#include <BootTimer.h>  // Fast boot and boot-time measurement (../common)
+
 // Pin definitions
 #define LED_RED     8
 #define BUTTON_USER 2
 
+#define BUTTON_USER_BIT (1 << 2)           // UNO pin 2 is PD2
+#define DEBOUNCE_PERIOD pdMS_TO_TICKS(15)  // Port sampling period
+
+// Signalling mode (override with build_flags in platformio.ini)
+// 0 = binary semaphore, 1 = direct-to-task notification (no semaphore object)
+#ifndef LED_SIGNAL_NOTIFY
+#define LED_SIGNAL_NOTIFY 0
+#endif
+
+// Give/take latency and RAM benchmark instead of the button demo
+#ifndef SIGNAL_BENCHMARK
+#define SIGNAL_BENCHMARK 0
+#endif
+
+#define BENCH_ITERATIONS 1000  // Signals measured per primitive
+
 // Declare a handle for the binary semaphore
 SemaphoreHandle_t xLedSemaphore = NULL;
 
+// Handle of the LED ON task, signalled directly in notification mode
+TaskHandle_t xLedOnTask = NULL;
+
+// Handle of the LED OFF task, notified of debounced button edges
+TaskHandle_t xLedOffTask = NULL;
+
+/**
+ * @brief Read the button port in one access
+ */
+static uint8_t ReadButtonPort() {
+#if defined(__AVR__)
+  return PIND;
+#else
+  // Other boards: assemble the same bit layout from the individual pins
+  return digitalRead(BUTTON_USER) << 2;
+#endif
+}
+
+// Active LOW button with internal pull-up
+PortDebouncer buttons(ReadButtonPort, BUTTON_USER_BIT, BUTTON_USER_BIT);
+
 /**
  * @brief Task to turn on the LED.
  * Waits for the semaphore to become available, simulates LED occupation for 1 second.
@@ -17,11 +59,19 @@ SemaphoreHandle_t xLedSemaphore = NULL;
 void TaskTurnOnLed(void *pvParameters) {
   (void) pvParameters;  // Unused parameter
 
+  BOOT_MARK_FIRST_TASK();  // Boot-critical task: its first action drives the LED
+
   // Infinite task loop
   while (1) {
+#if LED_SIGNAL_NOTIFY
+    // Wait indefinitely for the OFF task's notification
+    if (ulTaskNotifyTake(pdTRUE, portMAX_DELAY) > 0) {
+      Serial.println("Task ON: Notification received");
+#else
     // Wait indefinitely to take the semaphore
     if (xSemaphoreTake(xLedSemaphore, portMAX_DELAY) == pdTRUE) {
       Serial.println("Task ON: Semaphore taken");
+#endif
       digitalWrite(LED_RED, HIGH);
       Serial.println("Task ON: LED turned ON");
 
@@ -38,6 +88,7 @@ void TaskTurnOnLed(void *pvParameters) {
 
 /**
  * @brief Task to turn off the LED when button is pressed, and release the semaphore when button is released.
+ * Driven by debounced press/release edges, so the semaphore is given once per release.
  * @param pvParameters Pointer to task parameters (unused)
  */
 void TaskTurnOffLed(void *pvParameters) {
@@ -45,24 +96,119 @@ void TaskTurnOffLed(void *pvParameters) {
 
   // Infinite task loop
   while (1) {
-    int buttonState = digitalRead(BUTTON_USER);
+    // Wait for a debounced edge from the shared debouncer
+    uint32_t events = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY);
 
-    if (buttonState == LOW) {
+    if (PortDebouncer::pressed(events) & BUTTON_USER_BIT) {
       // Button pressed: immediately turn off LED
       digitalWrite(LED_RED, LOW);
       Serial.println("Task OFF: Button pressed, LED turned OFF");
     }
-    else if (buttonState == HIGH) {
+
+    if (PortDebouncer::released(events) & BUTTON_USER_BIT) {
+#if LED_SIGNAL_NOTIFY
+      // Release edge: signal the ON task directly
+      xTaskNotifyGive(xLedOnTask);
+      Serial.println("Task OFF: Button released, notification sent");
+#else
       // Button released: release the semaphore
       if (xSemaphoreGive(xLedSemaphore) == pdTRUE) {
         Serial.println("Task OFF: Button released, semaphore given");
       }
+#endif
     }
+  }
+}
+
+#if SIGNAL_BENCHMARK
+SemaphoreHandle_t xBenchSemaphore = NULL;
+TaskHandle_t xBenchTaker = NULL;
 
-    vTaskDelay(pdMS_TO_TICKS(50));  // Debounce delay
+size_t benchSemaphoreBytes = 0;         // Heap consumed by xSemaphoreCreateBinary()
+volatile uint32_t benchGiveTime = 0;    // micros() just before each give
+volatile uint32_t benchSemaphoreSum = 0;  // Sum of give-to-wake latencies, semaphore
+volatile uint32_t benchNotifySum = 0;     // Sum of give-to-wake latencies, notification
+
+/**
+ * @brief Benchmark taker - higher priority than the giver, so every give wakes it
+ *        immediately. Measures BENCH_ITERATIONS semaphore takes, then the same
+ *        number of notification takes.
+ * @param pvParameters Pointer to task parameters (unused)
+ */
+void TaskBenchTaker(void *pvParameters) {
+  (void) pvParameters;
+
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    xSemaphoreTake(xBenchSemaphore, portMAX_DELAY);
+    benchSemaphoreSum += micros() - benchGiveTime;
+  }
+
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    benchNotifySum += micros() - benchGiveTime;
   }
+
+  vTaskSuspend(NULL);
+}
+
+/**
+ * @brief Print one CSV row of benchmark results
+ */
+static void PrintBenchRow(const char *primitive, size_t ramBytes, uint32_t wakeSum, uint32_t pairSum) {
+  Serial.print(primitive);
+  Serial.print(',');
+  Serial.print((unsigned) ramBytes);
+  Serial.print(',');
+  Serial.print((float) wakeSum / BENCH_ITERATIONS);
+  Serial.print(',');
+  Serial.println((float) pairSum / BENCH_ITERATIONS);
 }
 
+/**
+ * @brief Benchmark giver - signals the taker through both primitives, then times
+ *        give+take pairs that complete without a context switch.
+ * @param pvParameters Pointer to task parameters (unused)
+ */
+void TaskBenchGiver(void *pvParameters) {
+  (void) pvParameters;
+
+  // Give-to-wake latency (includes the context switch to the taker)
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    benchGiveTime = micros();
+    xSemaphoreGive(xBenchSemaphore);
+  }
+
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    benchGiveTime = micros();
+    xTaskNotifyGive(xBenchTaker);
+  }
+
+  // Raw give+take cost within one task
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    xSemaphoreGive(xBenchSemaphore);
+    xSemaphoreTake(xBenchSemaphore, 0);
+  }
+  uint32_t semaphorePair = micros() - start;
+
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    xTaskNotifyGive(self);
+    ulTaskNotifyTake(pdTRUE, 0);
+  }
+  uint32_t notifyPair = micros() - start;
+
+  Serial.println("primitive,object_ram_bytes,give_to_wake_us,give_take_pair_us");
+  PrintBenchRow("semaphore", benchSemaphoreBytes, benchSemaphoreSum, semaphorePair);
+  PrintBenchRow("notification", 0, benchNotifySum, notifyPair);  // State lives in the TCB
+  Serial.println("Benchmark complete.");
+
+  vTaskSuspend(NULL);
+}
+#endif
+
 /**
  * @brief Arduino setup function - runs once at startup.
  * Initializes I/O pins, semaphore, and creates FreeRTOS tasks.
@@ -70,14 +216,69 @@ void TaskTurnOffLed(void *pvParameters) {
 void setup() {
   // Initialize serial communication
   Serial.begin(9600);
+#if !FAST_BOOT
   while (!Serial);  // Wait for Serial if necessary
+#endif
 
   // Configure pins
   pinMode(LED_RED, OUTPUT);
   pinMode(BUTTON_USER, INPUT_PULLUP);  // Active LOW button
 
+#if SIGNAL_BENCHMARK
+  // Measure the heap cost of the semaphore object itself
+  size_t freeBefore = HeapTrace_FreeHeap();
+  xBenchSemaphore = HEAP_TRACED("xBenchSemaphore", xSemaphoreCreateBinary());
+  benchSemaphoreBytes = freeBefore - HeapTrace_FreeHeap();
+
+  if (xBenchSemaphore == NULL) {
+    Serial.println("Error creating semaphore.");
+    while (1);  // Halt if semaphore failed
+  }
+
+  // Create the taker above the giver so each give switches to it immediately
+  HEAP_TRACED("Bench_Taker", xTaskCreate(
+    TaskBenchTaker,  // Task function
+    "Bench_Taker",   // Task name
+    128,             // Stack size
+    NULL,            // Task parameters
+    2,               // Task priority (higher)
+    &xBenchTaker     // Task handle (notified by the giver)
+  ));
+
+  HEAP_TRACED("Bench_Giver", xTaskCreate(
+    TaskBenchGiver,  // Task function
+    "Bench_Giver",   // Task name
+    192,             // Stack size (float formatting)
+    NULL,            // Task parameters
+    1,               // Task priority
+    NULL             // Task handle
+  ));
+#elif LED_SIGNAL_NOTIFY
+  // Create task to turn on the LED
+  HEAP_TRACED("LED_On_Task", xTaskCreate(
+    TaskTurnOnLed,   // Task function
+    "LED_On_Task",   // Task name
+    128,             // Stack size
+    NULL,            // Task parameters
+    1,               // Task priority
+    &xLedOnTask      // Task handle (notified by the OFF task)
+  ));
+
+  // Initial notification lets the ON task run once at start, like the initial give
+  xTaskNotifyGive(xLedOnTask);
+
+  // Create task to turn off the LED
+  HEAP_TRACED("LED_Off_Task", xTaskCreate(
+    TaskTurnOffLed,  // Task function
+    "LED_Off_Task",  // Task name
+    128,             // Stack size
+    NULL,            // Task parameters
+    1,               // Task priority
+    &xLedOffTask     // Task handle (notified by the debouncer)
+  ));
+#else
   // Create a binary semaphore
-  xLedSemaphore = xSemaphoreCreateBinary();
+  xLedSemaphore = HEAP_TRACED("xLedSemaphore", xSemaphoreCreateBinary());
 
   // Check semaphore creation
   if (xLedSemaphore == NULL) {
@@ -89,24 +290,39 @@ void setup() {
   xSemaphoreGive(xLedSemaphore);
 
   // Create task to turn on the LED
-  xTaskCreate(
+  HEAP_TRACED("LED_On_Task", xTaskCreate(
     TaskTurnOnLed,   // Task function
     "LED_On_Task",   // Task name
     128,             // Stack size
     NULL,            // Task parameters
     1,               // Task priority
     NULL             // Task handle
-  );
+  ));
 
   // Create task to turn off the LED
-  xTaskCreate(
+  HEAP_TRACED("LED_Off_Task", xTaskCreate(
     TaskTurnOffLed,  // Task function
     "LED_Off_Task",  // Task name
     128,             // Stack size
     NULL,            // Task parameters
     1,               // Task priority
-    NULL             // Task handle
-  );
+    &xLedOffTask     // Task handle (notified by the debouncer)
+  ));
+#endif
+
+#if !SIGNAL_BENCHMARK
+  // Sample the button port above the LED tasks
+  buttons.subscribe(xLedOffTask, BUTTON_USER_BIT);
+  buttons.begin(DEBOUNCE_PERIOD, 2);
+#endif
+
+  BOOT_DEFER(NULL);
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 /**
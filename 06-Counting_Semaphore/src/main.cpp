@@ -2,12 +2,20 @@
 #include <Arduino_FreeRTOS.h>
 #include <semphr.h>  // Required for using FreeRTOS semaphores
 
+#include <PortDebouncer.h>  // Shared port debouncer (../common)
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+#include <BootTimer.h>  // Fast boot and boot-time measurement (../common)
+
 // Pin definitions
 #define ENTRY_GATE_LED   7
 #define EXIT_GATE_LED    8
 #define OVERRIDE_LED     9
 #define EXIT_BUTTON     10
 
+#define EXIT_BUTTON_BIT  (1 << 2)           // UNO pin 10 is PB2
+#define DEBOUNCE_PERIOD  pdMS_TO_TICKS(15)  // Port sampling period
+
 #define TOTAL_PARKING_SPACES 2  // Total parking slots
 #define NUM_CARS              3 // Number of cars to simulate
 
@@ -16,6 +24,24 @@ const int parkingLEDs[] = {2, 3};  // LEDs representing occupied parking spots
 // Declare a handle for the counting semaphore
 SemaphoreHandle_t xParkingSemaphore = NULL;
 
+// Handle of the exit button task, notified of debounced edges
+TaskHandle_t xExitButtonTask = NULL;
+
+/**
+ * @brief Read the exit button port in one access
+ */
+static uint8_t ReadButtonPort() {
+#if defined(__AVR__)
+  return PINB;
+#else
+  // Other boards: assemble the same bit layout from the individual pins
+  return digitalRead(EXIT_BUTTON) << 2;
+#endif
+}
+
+// Active LOW button with internal pull-up
+PortDebouncer buttons(ReadButtonPort, EXIT_BUTTON_BIT, EXIT_BUTTON_BIT);
+
 /**
  * @brief Task for Car 1.
  * Attempts to park, occupies space, simulates parking, and then exits.
@@ -96,8 +122,14 @@ void CarTask2(void *pvParameters) {
 void ExitButtonTask(void *pvParameters) {
   (void) pvParameters;  // Unused parameter
 
+  BOOT_MARK_FIRST_TASK();  // Boot-critical task: highest priority
+
   while (1) {
-    if (digitalRead(EXIT_BUTTON) == LOW) {
+    // Wait for a debounced press from the shared debouncer
+    uint32_t events = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &events, portMAX_DELAY);
+
+    if (PortDebouncer::pressed(events) & EXIT_BUTTON_BIT) {
       if (uxSemaphoreGetCount(xParkingSemaphore) < TOTAL_PARKING_SPACES) {
         xSemaphoreGive(xParkingSemaphore);
         digitalWrite(OVERRIDE_LED, HIGH);
@@ -107,13 +139,21 @@ void ExitButtonTask(void *pvParameters) {
         vTaskDelay(pdMS_TO_TICKS(500));
         digitalWrite(OVERRIDE_LED, LOW);
       }
-      vTaskDelay(pdMS_TO_TICKS(500));  // Debounce delay
     }
-
-    vTaskDelay(pdMS_TO_TICKS(100));  // Polling interval
   }
 }
 
+/**
+ * @brief Non-critical start-up: runs at the end of setup(), or after the
+ *        control tasks have started in a fast boot
+ */
+static void StartupDeferred() {
+  // System startup message
+  Serial.println("Parking lot system started!");
+  Serial.print("Total parking spaces: ");
+  Serial.println(TOTAL_PARKING_SPACES);
+}
+
 /**
  * @brief Arduino setup function - runs once at startup.
  * Initializes I/O pins, semaphore, and creates FreeRTOS tasks.
@@ -121,7 +161,9 @@ void ExitButtonTask(void *pvParameters) {
 void setup() {
   // Initialize serial communication
   Serial.begin(9600);
+#if !FAST_BOOT
   while (!Serial);  // Wait for Serial if necessary
+#endif
 
   // Configure parking LEDs
   for (int i = 0; i < TOTAL_PARKING_SPACES; i++) {
@@ -136,7 +178,7 @@ void setup() {
   pinMode(EXIT_BUTTON, INPUT_PULLUP);  // Active LOW button
 
   // Create the counting semaphore
-  xParkingSemaphore = xSemaphoreCreateCounting(TOTAL_PARKING_SPACES, TOTAL_PARKING_SPACES);
+  xParkingSemaphore = HEAP_TRACED("xParkingSemaphore", xSemaphoreCreateCounting(TOTAL_PARKING_SPACES, TOTAL_PARKING_SPACES));
 
   // Check semaphore creation
   if (xParkingSemaphore == NULL) {
@@ -145,39 +187,47 @@ void setup() {
   }
 
   // Create task for Car 1
-  xTaskCreate(
+  HEAP_TRACED("Car_1_Task", xTaskCreate(
     CarTask1,         // Task function
     "Car_1_Task",     // Task name
     128,              // Stack size
     NULL,             // Task parameters
     1,                // Task priority
     NULL              // Task handle
-  );
+  ));
 
   // Create task for Car 2
-  xTaskCreate(
+  HEAP_TRACED("Car_2_Task", xTaskCreate(
     CarTask2,         // Task function
     "Car_2_Task",     // Task name
     128,              // Stack size
     NULL,             // Task parameters
     1,                // Task priority
     NULL              // Task handle
-  );
+  ));
 
   // Create task for manual exit button
-  xTaskCreate(
+  HEAP_TRACED("Exit_Button_Task", xTaskCreate(
     ExitButtonTask,   // Task function
     "Exit_Button_Task", // Task name
     128,              // Stack size
     NULL,             // Task parameters
     2,                // Task priority (higher)
-    NULL              // Task handle
-  );
+    &xExitButtonTask  // Task handle (notified by the debouncer)
+  ));
 
-  // System startup message
-  Serial.println("Parking lot system started!");
-  Serial.print("Total parking spaces: ");
-  Serial.println(TOTAL_PARKING_SPACES);
+  // Sample the button port alongside the exit button task
+  buttons.subscribe(xExitButtonTask, EXIT_BUTTON_BIT);
+  buttons.begin(DEBOUNCE_PERIOD, 2);
+
+  BOOT_DEFER(StartupDeferred);
+
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 /**
@@ -2,6 +2,11 @@
 #include <Arduino_FreeRTOS.h>
 #include <semphr.h>  // Required for using FreeRTOS semaphores
 
+#include <HeapTrace.h>  // Optional heap instrumentation (../common)
+#include <SchedStats.h>  // Optional scheduler statistics (../common)
+#include <BootTimer.h>  // Fast boot and boot-time measurement (../common)
+#include <PeriodicTask.h>  // Deadline-miss monitor (../common)
+
 // 📌 Pin Definitions
 #define POTENTIOMETER_PIN  A0
 #define RED_LED_PIN        5
@@ -12,6 +17,26 @@
 volatile int adcValue = 0;  // Shared ADC value (volatile for task access)
 SemaphoreHandle_t xADCMutex = NULL;  // Mutex to protect shared resource
 
+// ⏱️ Deadline monitoring
+// Print the full deadline report every N print cycles (0 = only report misses)
+#ifndef DEADLINE_REPORT_EVERY
+#define DEADLINE_REPORT_EVERY 0
+#endif
+
+const char * volatile missedTaskName = NULL;  // Last task that missed, printed by TaskPrintADC
+
+/**
+ * @brief Deadline-miss hook - runs in the late task, so only records the miss
+ */
+void OnDeadlineMiss(PeriodicTask *task, uint32_t responseMicros) {
+  (void) responseMicros;
+  missedTaskName = task->name();
+}
+
+// Implicit deadlines: each job must finish before its next release
+PeriodicTask adcPeriodic("ADC_Read_Task", pdMS_TO_TICKS(50), 0, OnDeadlineMiss);
+PeriodicTask ledPeriodic("LED_Control_Task", pdMS_TO_TICKS(100), 0, OnDeadlineMiss);
+
 /**
  * @brief Task to periodically read the analog input from the potentiometer.
  *        Updates shared adcValue under mutex protection.
@@ -20,13 +45,17 @@ SemaphoreHandle_t xADCMutex = NULL;  // Mutex to protect shared resource
 void TaskReadADC(void *pvParameters) {
   (void) pvParameters;
 
+  BOOT_MARK_FIRST_TASK();  // Boot-critical task: highest priority
+
+  adcPeriodic.start();
+
   while (1) {
     if (xSemaphoreTake(xADCMutex, portMAX_DELAY) == pdTRUE) {
       adcValue = analogRead(POTENTIOMETER_PIN);  // Critical section
       xSemaphoreGive(xADCMutex);
     }
 
-    vTaskDelay(pdMS_TO_TICKS(50));  // Read every 50ms
+    adcPeriodic.waitForNextPeriod();  // Read every 50ms
   }
 }
 
@@ -38,6 +67,10 @@ void TaskReadADC(void *pvParameters) {
 void TaskPrintADC(void *pvParameters) {
   (void) pvParameters;
 
+#if DEADLINE_REPORT_EVERY
+  uint16_t cycles = 0;
+#endif
+
   while (1) {
     if (xSemaphoreTake(xADCMutex, portMAX_DELAY) == pdTRUE) {
       Serial.print("ADC Value: ");
@@ -45,6 +78,21 @@ void TaskPrintADC(void *pvParameters) {
       xSemaphoreGive(xADCMutex);
     }
 
+    // Deadline output is printed outside the mutex so it cannot delay the monitored tasks
+    const char *missed = missedTaskName;
+    if (missed != NULL) {
+      missedTaskName = NULL;
+      Serial.print("Deadline missed: ");
+      Serial.println(missed);
+    }
+
+#if DEADLINE_REPORT_EVERY
+    if (++cycles >= DEADLINE_REPORT_EVERY) {
+      cycles = 0;
+      PeriodicTask::report(Serial);
+    }
+#endif
+
     vTaskDelay(pdMS_TO_TICKS(200));  // Print every 200ms
   }
 }
@@ -57,6 +105,8 @@ void TaskPrintADC(void *pvParameters) {
 void TaskControlLEDs(void *pvParameters) {
   (void) pvParameters;
 
+  ledPeriodic.start();
+
   while (1) {
     int localValue = 0;
 
@@ -82,16 +132,46 @@ void TaskControlLEDs(void *pvParameters) {
       digitalWrite(GREEN_LED_PIN, HIGH);
     }
 
-    vTaskDelay(pdMS_TO_TICKS(100));  // Update every 100ms
+    ledPeriodic.waitForNextPeriod();  // Update every 100ms
   }
 }
 
+/**
+ * @brief Create the task that prints the ADC value
+ */
+static void CreatePrintTask() {
+  HEAP_TRACED("ADC_Print_Task", xTaskCreate(
+    TaskPrintADC,        // Task function
+    "ADC_Print_Task",    // Task name
+    192,                 // Stack size (Serial output of 32-bit counters in the deadline report)
+    NULL,                // Parameters
+    1,                   // Priority
+    NULL                 // Task handle
+  ));
+}
+
+/**
+ * @brief Non-critical start-up: runs at the end of setup(), or after the
+ *        control tasks have started in a fast boot
+ */
+static void StartupDeferred() {
+  // Startup message
+  Serial.println("ADC Monitoring System Started");
+
+#if FAST_BOOT
+  // Serial output is not needed for control, so its task starts last
+  CreatePrintTask();
+#endif
+}
+
 /**
  * @brief Arduino setup function - initializes I/O, mutex, and FreeRTOS tasks.
  */
 void setup() {
   Serial.begin(9600);
+#if !FAST_BOOT
   while (!Serial);  // Wait for Serial if needed
+#endif
 
   // Configure I/O pins
   pinMode(POTENTIOMETER_PIN, INPUT);
@@ -105,42 +185,43 @@ void setup() {
   digitalWrite(GREEN_LED_PIN, LOW);
 
   // Create mutex
-  xADCMutex = xSemaphoreCreateMutex();
+  xADCMutex = HEAP_TRACED("xADCMutex", xSemaphoreCreateMutex());
   if (xADCMutex == NULL) {
     Serial.println("Error: Failed to create ADC mutex");
     while (1);  // Stop execution
   }
 // Create task for reading ADC value
-  xTaskCreate(
+  HEAP_TRACED("ADC_Read_Task", xTaskCreate(
     TaskReadADC,         // Task function
     "ADC_Read_Task",     // Task name (for debugging)
     128,                 // Stack size
     NULL,                // Parameters
     2,                   // Priority (higher)
     NULL                 // Task handle (not used)
-  );
+  ));
 
+#if !FAST_BOOT
   // Create task for printing ADC value
-  xTaskCreate(
-    TaskPrintADC,        // Task function
-    "ADC_Print_Task",    // Task name
-    128,                 // Stack size
-    NULL,                // Parameters
-    1,                   // Priority
-    NULL                 // Task handle
-  );
+  CreatePrintTask();
+#endif
 
   // Create task for controlling LEDs based on ADC
-  xTaskCreate(
+  HEAP_TRACED("LED_Control_Task", xTaskCreate(
     TaskControlLEDs,     // Task function
     "LED_Control_Task",  // Task name
     128,                 // Stack size
     NULL,                // Parameters
     1,                   // Priority
     NULL                 // Task handle
-  );
-  // Startup message
-  Serial.println("ADC Monitoring System Started");
+  ));
+  BOOT_DEFER(StartupDeferred);
+
+  SCHED_STATS_BEGIN();
+  HEAP_TRACE_REPORT();
+
+#if !defined(__AVR__)
+  vTaskStartScheduler();  // The AVR port starts the scheduler after setup() returns
+#endif
 }
 
 /**
@@ -0,0 +1,61 @@
+#include "BlockPool.h"
+
+#include <Arduino_FreeRTOS.h>
+
+size_t BlockPool::roundedSize(size_t blockSize) {
+  const size_t align = sizeof(void *);
+  if (blockSize < sizeof(FreeBlock)) {
+    blockSize = sizeof(FreeBlock);
+  }
+  return (blockSize + align - 1) & ~(align - 1);
+}
+
+BlockPool::BlockPool(void *storage, size_t storageBytes, size_t blockSize, uint16_t count)
+  : freeList(NULL), size(roundedSize(blockSize)) {
+  // Never chain blocks past the end of the caller's buffer
+  if (storageBytes < storageSize(blockSize, count)) {
+    count = storageBytes / size;
+  }
+  freeCount = count;
+  minFreeCount = count;
+
+  // Chain every block into the free list, first block at the head
+  uint8_t *block = (uint8_t *) storage + (size_t) count * size;
+  for (uint16_t i = 0; i < count; i++) {
+    block -= size;
+    FreeBlock *node = (FreeBlock *) block;
+    node->next = freeList;
+    freeList = node;
+  }
+}
+
+void *BlockPool::allocate() {
+  taskENTER_CRITICAL();
+
+  FreeBlock *block = freeList;
+  if (block != NULL) {
+    freeList = block->next;
+    freeCount--;
+    if (freeCount < minFreeCount) {
+      minFreeCount = freeCount;
+    }
+  }
+
+  taskEXIT_CRITICAL();
+  return block;
+}
+
+void BlockPool::release(void *block) {
+  if (block == NULL) {
+    return;
+  }
+
+  taskENTER_CRITICAL();
+
+  FreeBlock *node = (FreeBlock *) block;
+  node->next = freeList;
+  freeList = node;
+  freeCount++;
+
+  taskEXIT_CRITICAL();
+}
@@ -0,0 +1,59 @@
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Fixed-block allocator for same-sized objects (queue items, buffers, stacks).
+ *
+ * Free blocks are chained through their own first bytes, so allocate() and
+ * release() are O(1), never fragment and carry no per-block header. Both are
+ * safe to call from any task (short critical section), not from ISRs.
+ */
+class BlockPool {
+public:
+  /**
+   * @param storage      Pointer-aligned backing memory, owned by the caller
+   * @param storageBytes Size of @p storage; storageSize(blockSize, count) for @p count blocks
+   * @param blockSize    Size of each block; rounded up to hold a pointer and keep alignment
+   * @param count        Number of blocks, reduced to what fits in @p storageBytes
+   */
+  BlockPool(void *storage, size_t storageBytes, size_t blockSize, uint16_t count);
+
+  /**
+   * @return A free block, or NULL if the pool is exhausted
+   */
+  void *allocate();
+
+  /**
+   * @brief Return a block obtained from allocate() to the pool
+   */
+  void release(void *block);
+
+  uint16_t available() const { return freeCount; }
+  uint16_t minimumEverAvailable() const { return minFreeCount; }
+  size_t blockSize() const { return size; }
+
+  /**
+   * @brief Block size actually used for a requested size
+   */
+  static size_t roundedSize(size_t blockSize);
+
+  /**
+   * @brief Backing memory needed for @p count blocks of @p blockSize bytes
+   */
+  static size_t storageSize(size_t blockSize, uint16_t count) { return roundedSize(blockSize) * count; }
+
+private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  FreeBlock *freeList;
+  size_t size;
+  uint16_t freeCount;
+  uint16_t minFreeCount;
+};
+
+#endif
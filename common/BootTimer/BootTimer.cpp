@@ -0,0 +1,55 @@
+#include "BootTimer.h"
+
+#if BOOT_TIMING
+
+#include <Arduino.h>
+#include <task.h>
+
+#include <HeapTrace.h>
+
+static volatile uint32_t firstTaskMicros = 0;
+static uint32_t setupEndMicros = 0;
+
+void BootTimer_MarkFirstTask() {
+  if (firstTaskMicros == 0) {
+    firstTaskMicros = micros();
+  }
+}
+
+/**
+ * @brief Boot task - idle priority, so it only runs once the demo's tasks have blocked
+ */
+static void TaskBoot(void *pvParameters) {
+#if FAST_BOOT
+  BootTimer_RunNow((BootInit) pvParameters);
+#else
+  (void) pvParameters;
+#endif
+
+  Serial.println("boot,setup_us,first_task_us");
+  Serial.print(FAST_BOOT ? "fast," : "normal,");
+  Serial.print(setupEndMicros);
+  Serial.print(',');
+  Serial.println(firstTaskMicros);
+
+  vTaskDelete(NULL);  // Stack and TCB are freed by the idle task
+}
+
+void BootTimer_Defer(BootInit init) {
+#if !FAST_BOOT
+  BootTimer_RunNow(init);
+  init = NULL;
+#endif
+  setupEndMicros = micros();
+
+  HEAP_TRACED("Boot", xTaskCreate(
+    TaskBoot,          // Task function
+    "Boot",            // Task name
+    160,               // Stack size (deferred init may create tasks and print)
+    (void *) init,     // Deferred init
+    tskIDLE_PRIORITY,  // Task priority (below every demo task)
+    NULL               // Task handle
+  ));
+}
+
+#endif
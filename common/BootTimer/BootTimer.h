@@ -0,0 +1,53 @@
+#ifndef BOOT_TIMER_H
+#define BOOT_TIMER_H
+
+#include <Arduino_FreeRTOS.h>
+
+// Fast boot (-D FAST_BOOT=1): no blocking waits, non-critical init deferred
+#ifndef FAST_BOOT
+#define FAST_BOOT 0
+#endif
+
+// Boot-time measurement (-D BOOT_TIMING=1 alone measures the normal boot)
+#ifndef BOOT_TIMING
+#define BOOT_TIMING FAST_BOOT
+#endif
+
+typedef void (*BootInit)();
+
+#if BOOT_TIMING
+#define BOOT_MARK_FIRST_TASK() BootTimer_MarkFirstTask()
+#define BOOT_DEFER(init) BootTimer_Defer(init)
+#else
+#define BOOT_MARK_FIRST_TASK() do {} while (0)
+#define BOOT_DEFER(init) BootTimer_RunNow(init)
+#endif
+
+/**
+ * @brief Record the first instruction of the boot-critical task (only the first call counts)
+ */
+void BootTimer_MarkFirstTask();
+
+/**
+ * @brief Call at the end of setup(). With FAST_BOOT, @p init (may be NULL) runs
+ *        in an idle-priority task once every other task has had the CPU;
+ *        otherwise it runs now. Then prints, from that task:
+ *
+ *          boot,setup_us,first_task_us
+ *          fast,<us>,<us>
+ *
+ *        Times count from the Arduino core's timer start (micros() == 0),
+ *        so the bootloader and C runtime start-up are not included.
+ */
+void BootTimer_Defer(BootInit init);
+
+/**
+ * @brief Run @p init immediately (boot timing disabled)
+ */
+static inline void BootTimer_RunNow(BootInit init) {
+  if (init != NULL) {
+    init();
+  }
+}
+
+#endif
@@ -0,0 +1,252 @@
+#include "HeapTrace.h"
+
+#include <Arduino.h>
+
+#if defined(__AVR__)
+// avr-libc malloc state, used by the feilipu port's heap_3
+extern char *__brkval;
+extern char __heap_start;
+extern char *__malloc_heap_end;
+extern size_t __malloc_margin;
+
+struct __freelist {
+  size_t sz;
+  struct __freelist *nx;
+};
+extern struct __freelist *__flp;
+
+#define HEAP_SCHEME "heap_3 (avr-libc malloc)"
+#define HEAP_CAN_FREE 1
+#define HEAP_HAS_WATERMARK 0
+
+size_t HeapTrace_FreeHeap() {
+  static char *mainStackLimit = NULL;
+  char *brk = __brkval ? __brkval : &__heap_start;
+
+  // Same limit malloc() uses when __malloc_heap_end is not set. Task stacks
+  // live inside the heap, so from a task use the last main-stack limit seen.
+  char *sp = (char *) SP;
+  if (sp > brk) {
+    mainStackLimit = sp - __malloc_margin;
+  }
+  char *top = __malloc_heap_end ? __malloc_heap_end : mainStackLimit;
+
+  size_t free = (top > brk) ? (size_t) (top - brk) : 0;
+  for (struct __freelist *fp = __flp; fp != NULL; fp = fp->nx) {
+    free += fp->sz;
+  }
+  return free;
+}
+#else
+#if defined(configMEMMANG_HEAP_NB)
+// STM32duino FreeRTOS selects heap_1/2/4/5 with configMEMMANG_HEAP_NB
+#define HEAP_SCHEME_NAME(nb) "heap_" #nb " (xPortGetFreeHeapSize)"
+#define HEAP_SCHEME_EXPAND(nb) HEAP_SCHEME_NAME(nb)
+#define HEAP_SCHEME HEAP_SCHEME_EXPAND(configMEMMANG_HEAP_NB)
+#define HEAP_CAN_FREE (configMEMMANG_HEAP_NB != 1)  // heap_1 never frees
+#define HEAP_HAS_WATERMARK (configMEMMANG_HEAP_NB >= 4)  // heap_1/2 keep no minimum
+#else
+#define HEAP_SCHEME "port heap (xPortGetFreeHeapSize)"
+#define HEAP_CAN_FREE 1
+#define HEAP_HAS_WATERMARK 1
+#endif
+
+size_t HeapTrace_FreeHeap() {
+  return xPortGetFreeHeapSize();
+}
+#endif
+
+#if HEAP_TRACE
+
+#include <task.h>
+#include <BlockPool.h>
+
+#define POOL_BENCH_BLOCKS 8   // Blocks allocated and freed per comparison round
+#define POOL_BENCH_SIZE   16  // Size of each block (about one queue item or small record)
+#define POOL_BENCH_ROUNDS 50  // Rounds averaged
+
+struct HeapTraceSite {
+  const char *label;
+  uint16_t line;
+  uint16_t bytes;
+  uint16_t micros;
+};
+
+static HeapTraceSite sites[HEAP_TRACE_MAX_SITES];
+static uint8_t siteCount = 0;
+static uint32_t totalBytes = 0;
+static uint16_t totalCalls = 0;
+
+static size_t beginFree = 0;
+static uint32_t beginMicros = 0;
+static size_t minEverFree = (size_t) -1;
+static size_t preSchedulerFree = 0;  // Free heap when setup() hands over to the kernel
+
+/**
+ * @brief Sample the free heap and keep the lowest value seen
+ */
+static size_t SampleFreeHeap() {
+  size_t free = HeapTrace_FreeHeap();
+  if (free < minEverFree) {
+    minEverFree = free;
+  }
+  return free;
+}
+
+size_t HeapTrace_MinimumEverFreeHeap() {
+#if HEAP_HAS_WATERMARK
+  return xPortGetMinimumEverFreeHeapSize();
+#else
+  SampleFreeHeap();
+  return minEverFree;
+#endif
+}
+
+void HeapTrace_Begin() {
+  beginFree = SampleFreeHeap();
+  beginMicros = micros();
+}
+
+void HeapTrace_End(const char *label, uint16_t line) {
+  uint16_t elapsed = (uint16_t) (micros() - beginMicros);
+  size_t endFree = SampleFreeHeap();
+  uint16_t used = (beginFree > endFree) ? (uint16_t) (beginFree - endFree) : 0;
+
+  totalBytes += used;
+  totalCalls++;
+
+  if (siteCount < HEAP_TRACE_MAX_SITES) {
+    HeapTraceSite *site = &sites[siteCount++];
+    site->label = label;
+    site->line = line;
+    site->bytes = used;
+    site->micros = elapsed;
+  }
+}
+
+/**
+ * @brief Average microseconds to allocate and free POOL_BENCH_BLOCKS blocks,
+ *        from the kernel heap or from a BlockPool
+ */
+#if HEAP_CAN_FREE
+static uint32_t TimeKernelHeap() {
+  void *blocks[POOL_BENCH_BLOCKS];
+
+  uint32_t start = micros();
+  for (uint8_t r = 0; r < POOL_BENCH_ROUNDS; r++) {
+    for (uint8_t i = 0; i < POOL_BENCH_BLOCKS; i++) {
+      blocks[i] = pvPortMalloc(POOL_BENCH_SIZE);
+    }
+    for (uint8_t i = 0; i < POOL_BENCH_BLOCKS; i++) {
+      vPortFree(blocks[i]);
+    }
+  }
+  return (micros() - start) / POOL_BENCH_ROUNDS;
+}
+#endif
+
+static uint32_t TimeBlockPool(BlockPool &pool) {
+  void *blocks[POOL_BENCH_BLOCKS];
+
+  uint32_t start = micros();
+  for (uint8_t r = 0; r < POOL_BENCH_ROUNDS; r++) {
+    for (uint8_t i = 0; i < POOL_BENCH_BLOCKS; i++) {
+      blocks[i] = pool.allocate();
+    }
+    for (uint8_t i = 0; i < POOL_BENCH_BLOCKS; i++) {
+      pool.release(blocks[i]);
+    }
+  }
+  return (micros() - start) / POOL_BENCH_ROUNDS;
+}
+
+/**
+ * @brief Runs first once the scheduler has started (highest priority), so the
+ *        heap it sees differs from setup()'s only by the kernel's own tasks
+ */
+static void TaskHeapReport(void *pvParameters) {
+  (void) pvParameters;
+
+  size_t runningFree = SampleFreeHeap();
+  uint16_t kernelBytes = (preSchedulerFree > runningFree) ? (uint16_t) (preSchedulerFree - runningFree) : 0;
+
+  // Print below the demo's tasks
+  vTaskPrioritySet(NULL, tskIDLE_PRIORITY + 1);
+
+  Serial.print("Scheduler start: ");
+  Serial.print(kernelBytes);
+  Serial.println(" bytes (idle and timer tasks)");
+  Serial.print("Total footprint: ");
+  Serial.print(totalBytes + kernelBytes);
+  Serial.println(" bytes");
+  Serial.print("Free heap (scheduler running): ");
+  Serial.println((unsigned long) runningFree);
+  Serial.print("Minimum ever free heap: ");
+  Serial.println((unsigned long) HeapTrace_MinimumEverFreeHeap());
+
+#if HEAP_CAN_FREE
+  vTaskDelete(NULL);
+#else
+  vTaskSuspend(NULL);  // The idle task could not free this task's memory
+#endif
+}
+
+void HeapTrace_Report() {
+  // Created first so that it is part of the boot footprint
+  HEAP_TRACED("HeapReport", xTaskCreate(
+    TaskHeapReport,            // Task function
+    "HeapReport",              // Task name
+    160,                       // Stack size (Serial output of 32-bit counters)
+    NULL,                      // Task parameters
+    configMAX_PRIORITIES - 1,  // Highest priority: samples the heap before any demo task runs
+    NULL                       // Task handle
+  ));
+
+  Serial.println("site,line,bytes,alloc_us");
+  for (uint8_t i = 0; i < siteCount; i++) {
+    Serial.print(sites[i].label);
+    Serial.print(',');
+    Serial.print(sites[i].line);
+    Serial.print(',');
+    Serial.print(sites[i].bytes);
+    Serial.print(',');
+    Serial.println(sites[i].micros);
+  }
+
+  Serial.print("Heap scheme: ");
+  Serial.println(HEAP_SCHEME);
+  Serial.print("Boot footprint (pre-scheduler): ");
+  Serial.print(totalBytes);
+  Serial.print(" bytes in ");
+  Serial.print(totalCalls);
+  Serial.println(" allocations");
+  Serial.print("Free heap (pre-scheduler): ");
+  Serial.println((unsigned long) SampleFreeHeap());
+
+  // Same-sized blocks: kernel heap vs. a pool on setup()'s stack, so the
+  // comparison leaves nothing behind on heap_1 (which cannot free)
+  void *storage[POOL_BENCH_BLOCKS * POOL_BENCH_SIZE / sizeof(void *)];
+  BlockPool pool(storage, sizeof(storage), POOL_BENCH_SIZE, POOL_BENCH_BLOCKS);
+
+  Serial.println("allocator,blocks,block_size,alloc_free_us");
+  Serial.print("kernel_heap,");
+  Serial.print(POOL_BENCH_BLOCKS);
+  Serial.print(',');
+  Serial.print(POOL_BENCH_SIZE);
+  Serial.print(',');
+#if HEAP_CAN_FREE
+  Serial.println(TimeKernelHeap());
+#else
+  Serial.println("n/a");
+#endif
+  Serial.print("block_pool,");
+  Serial.print(POOL_BENCH_BLOCKS);
+  Serial.print(',');
+  Serial.print(POOL_BENCH_SIZE);
+  Serial.print(',');
+  Serial.println(TimeBlockPool(pool));
+
+  preSchedulerFree = SampleFreeHeap();
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef HEAP_TRACE_H
+#define HEAP_TRACE_H
+
+#include <Arduino_FreeRTOS.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Heap instrumentation (enable with build_flags = -D HEAP_TRACE=1)
+#ifndef HEAP_TRACE
+#define HEAP_TRACE 0
+#endif
+
+#define HEAP_TRACE_MAX_SITES 12  // Call sites recorded; later ones are only totalled
+
+#if HEAP_TRACE
+/**
+ * @brief Evaluate an allocating kernel call and record its heap usage and time
+ *        under @p label, e.g. xQueue = HEAP_TRACED("xQueue", xQueueCreate(5, 4));
+ */
+#define HEAP_TRACED(label, call) \
+  __extension__ ({ \
+    HeapTrace_Begin(); \
+    __typeof__(call) heapTraceResult = (call); \
+    HeapTrace_End((label), __LINE__); \
+    heapTraceResult; \
+  })
+
+#define HEAP_TRACE_REPORT() HeapTrace_Report()
+#else
+#define HEAP_TRACED(label, call) (call)
+#define HEAP_TRACE_REPORT() do {} while (0)
+#endif
+
+void HeapTrace_Begin();
+void HeapTrace_End(const char *label, uint16_t line);
+
+/**
+ * @brief Bytes the kernel allocator can still hand out (available without
+ *        HEAP_TRACE). With heap_3 on AVR this is measured from malloc's state;
+ *        from a task it uses the main-stack limit recorded by the last call
+ *        from setup().
+ */
+size_t HeapTrace_FreeHeap();
+
+/**
+ * @brief Lowest free heap: the kernel's watermark where the port keeps one,
+ *        otherwise the lowest value seen by any traced call or report
+ */
+size_t HeapTrace_MinimumEverFreeHeap();
+
+/**
+ * @brief Call at the end of setup(). Prints every traced call site, the
+ *        pre-scheduler footprint and free heap, and an allocation-time
+ *        comparison against BlockPool on Serial. A highest-priority task then
+ *        reports what the scheduler itself allocated once it is running.
+ */
+void HeapTrace_Report();
+
+#endif
@@ -0,0 +1,71 @@
+#include "PeriodicTask.h"
+
+#include <task.h>
+
+#define TICK_MICROS ((uint32_t) portTICK_PERIOD_MS * 1000)
+
+PeriodicTask *PeriodicTask::first = NULL;
+
+PeriodicTask::PeriodicTask(const char *name, TickType_t period, TickType_t deadline, MissHook onMiss)
+  : label(name), periodTicks(period), deadlineTicks(deadline ? deadline : period), missHook(onMiss),
+    releaseTime(0), releaseMicros(0), worstMicros(0), lastMicros(0), jobCount(0), missCount(0), next(first) {
+  // Monitors are global objects, so this runs before the scheduler starts
+  first = this;
+}
+
+void PeriodicTask::start() {
+  releaseMicros = micros();
+  releaseTime = xTaskGetTickCount();
+}
+
+bool PeriodicTask::waitForNextPeriod() {
+  uint32_t response = micros() - releaseMicros;
+
+  lastMicros = response;
+  if (response > worstMicros) {
+    worstMicros = response;
+  }
+  jobCount++;
+
+  if (response > (uint32_t) deadlineTicks * TICK_MICROS) {
+    missCount++;
+    if (missHook != NULL) {
+      missHook(this, response);
+    }
+  }
+
+  // Advances releaseTime by exactly one period
+  bool onTime = xTaskDelayUntil(&releaseTime, periodTicks) == pdTRUE;
+
+  // Wake-up time, moved back by the whole ticks it trailed the release (overrun or preemption)
+  releaseMicros = micros() - (uint32_t) (TickType_t) (xTaskGetTickCount() - releaseTime) * TICK_MICROS;
+  return onTime;
+}
+
+void PeriodicTask::report(Print &out) {
+  out.println("task,period_ms,deadline_ms,jobs,misses,wcrt_us,last_us");
+
+  for (PeriodicTask *t = first; t != NULL; t = t->next) {
+    // Snapshot the counters so a job completing mid-report cannot tear them
+    taskENTER_CRITICAL();
+    uint32_t jobs = t->jobCount;
+    uint32_t misses = t->missCount;
+    uint32_t worst = t->worstMicros;
+    uint32_t last = t->lastMicros;
+    taskEXIT_CRITICAL();
+
+    out.print(t->label);
+    out.print(',');
+    out.print((uint32_t) t->periodTicks * portTICK_PERIOD_MS);
+    out.print(',');
+    out.print((uint32_t) t->deadlineTicks * portTICK_PERIOD_MS);
+    out.print(',');
+    out.print(jobs);
+    out.print(',');
+    out.print(misses);
+    out.print(',');
+    out.print(worst);
+    out.print(',');
+    out.println(last);
+  }
+}
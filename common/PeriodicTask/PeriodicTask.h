@@ -0,0 +1,82 @@
+#ifndef PERIODIC_TASK_H
+#define PERIODIC_TASK_H
+
+#include <Arduino.h>
+#include <Arduino_FreeRTOS.h>
+
+/**
+ * @brief Release-based timing for a periodic task, with deadline-miss detection.
+ *
+ * Replaces the task's vTaskDelayUntil() call. Each job's response time is
+ * measured in microseconds, from its ideal release (period boundary) to the
+ * call of waitForNextPeriod(). The task's wake-up and the job's completion are
+ * timestamped with micros(). Whole ticks by which the wake-up trailed the
+ * release are added, and ticks are only used to schedule releases. Updating
+ * the statistics costs two micros() reads, one tick read and a few
+ * comparisons per job, so monitors can stay enabled in production;
+ * report() is only called on demand.
+ *
+ *   PeriodicTask adcPeriodic("ADC", pdMS_TO_TICKS(50));
+ *
+ *   void TaskReadADC(void *) {
+ *     adcPeriodic.start();
+ *     while (1) {
+ *       ...job...
+ *       adcPeriodic.waitForNextPeriod();
+ *     }
+ *   }
+ */
+class PeriodicTask {
+public:
+  typedef void (*MissHook)(PeriodicTask *task, uint32_t responseMicros);
+
+  /**
+   * @param name     Label used by report()
+   * @param period   Release period in ticks
+   * @param deadline Relative deadline in ticks (0 = implicit, equal to the period)
+   * @param onMiss   Optional hook called from the task when a job misses its deadline
+   */
+  PeriodicTask(const char *name, TickType_t period, TickType_t deadline = 0, MissHook onMiss = NULL);
+
+  /**
+   * @brief Mark the first release; call once from the task before its loop
+   */
+  void start();
+
+  /**
+   * @brief Complete the current job and block until the next release
+   * @return false if the next release had already passed (overrun)
+   */
+  bool waitForNextPeriod();
+
+  const char *name() const { return label; }
+  TickType_t period() const { return periodTicks; }
+  TickType_t deadline() const { return deadlineTicks; }
+  uint32_t jobs() const { return jobCount; }
+  uint32_t misses() const { return missCount; }
+  uint32_t worstResponse() const { return worstMicros; }  // Microseconds
+  uint32_t lastResponse() const { return lastMicros; }    // Microseconds
+
+  /**
+   * @brief Print one CSV row per monitored task
+   */
+  static void report(Print &out);
+
+private:
+  const char *label;
+  TickType_t periodTicks;
+  TickType_t deadlineTicks;
+  MissHook missHook;
+
+  TickType_t releaseTime;  // Ideal release of the current job (ticks)
+  uint32_t releaseMicros;  // Same instant in micros(), estimated at wake-up
+  uint32_t worstMicros;
+  uint32_t lastMicros;
+  uint32_t jobCount;
+  uint32_t missCount;
+
+  PeriodicTask *next;           // Registry of all monitors, for report()
+  static PeriodicTask *first;
+};
+
+#endif
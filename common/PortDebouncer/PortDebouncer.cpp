@@ -0,0 +1,80 @@
+#include "PortDebouncer.h"
+
+#include <task.h>
+
+#include <HeapTrace.h>
+
+PortDebouncer::PortDebouncer(PortReader readPort, uint8_t mask, uint8_t activeLow)
+  : readPort(readPort), mask(mask), activeLow(activeLow), period(1),
+    debounced(0), count0(0), count1(0), subscriberCount(0) {
+}
+
+bool PortDebouncer::subscribe(TaskHandle_t task, uint8_t mask) {
+  if (subscriberCount >= MAX_SUBSCRIBERS) {
+    return false;
+  }
+
+  subscribers[subscriberCount] = task;
+  subscriberMasks[subscriberCount] = mask;
+  subscriberCount++;
+  return true;
+}
+
+BaseType_t PortDebouncer::begin(TickType_t period, UBaseType_t priority) {
+  this->period = (period == 0) ? 1 : period;
+
+  return HEAP_TRACED("Debounce", xTaskCreate(
+    task,          // Task function
+    "Debounce",    // Task name
+    128,           // Stack size
+    this,          // Task parameters (the debouncer instance)
+    priority,      // Task priority
+    NULL           // Task handle
+  ));
+}
+
+/**
+ * @brief Read the port and normalise it to 1 = pressed for every button bit
+ */
+uint8_t PortDebouncer::sample() const {
+  return (readPort() ^ activeLow) & mask;
+}
+
+void PortDebouncer::task(void *pvParameters) {
+  PortDebouncer *self = (PortDebouncer *) pvParameters;
+
+  // Start from the current levels so buttons held at boot do not report an edge
+  self->debounced = self->sample();
+
+  TickType_t xLastWakeTime = xTaskGetTickCount();
+
+  while (1) {
+    vTaskDelayUntil(&xLastWakeTime, self->period);
+
+    uint8_t state = self->debounced;
+    uint8_t delta = self->sample() ^ state;
+
+    // Count consecutive disagreeing samples per bit; any agreeing sample resets it
+    self->count1 = (self->count1 ^ self->count0) & delta;
+    self->count0 = ~self->count0 & delta;
+
+    // Bits whose counter wrapped to 0 while still disagreeing change state
+    uint8_t toggle = delta & ~(self->count0 | self->count1);
+    if (toggle == 0) {
+      continue;
+    }
+
+    state ^= toggle;
+    self->debounced = state;
+
+    uint8_t pressed = toggle & state;
+    uint8_t released = toggle & ~state;
+
+    for (uint8_t i = 0; i < self->subscriberCount; i++) {
+      uint8_t m = self->subscriberMasks[i];
+      if ((pressed | released) & m) {
+        xTaskNotify(self->subscribers[i], ((uint32_t) (released & m) << 8) | (pressed & m), eSetBits);
+      }
+    }
+  }
+}
@@ -0,0 +1,73 @@
+#ifndef PORT_DEBOUNCER_H
+#define PORT_DEBOUNCER_H
+
+#include <Arduino_FreeRTOS.h>
+#include <stdint.h>
+
+/**
+ * @brief Debounces up to 8 buttons on one input port with a single task.
+ *
+ * The whole port is read in one operation every period and all bits are
+ * debounced in parallel with 2-bit vertical counters: a bit changes state
+ * after 4 consecutive samples that disagree with it, so the cost per sample is
+ * the same handful of logic instructions for 1 or 8 buttons.
+ *
+ * Edges are published to subscribed tasks as a direct-to-task notification
+ * (eSetBits): bits 0-7 carry press edges, bits 8-15 release edges. Decode the
+ * value received from xTaskNotifyWait() with pressed() / released().
+ */
+class PortDebouncer {
+public:
+  typedef uint8_t (*PortReader)(void);
+
+  static const uint8_t MAX_SUBSCRIBERS = 4;
+
+  /**
+   * @param readPort  Returns the raw level of all 8 port bits in one read
+   * @param mask      Port bits wired to buttons
+   * @param activeLow Bits whose button reads LOW when pressed (pull-ups)
+   */
+  PortDebouncer(PortReader readPort, uint8_t mask, uint8_t activeLow);
+
+  /**
+   * @brief Register a task to be notified of edges on the bits in @p mask.
+   *        Call from setup(), before the scheduler starts.
+   * @return false if all subscriber slots are taken
+   */
+  bool subscribe(TaskHandle_t task, uint8_t mask);
+
+  /**
+   * @brief Create the sampling task.
+   * @param period   Sampling period in ticks (4 samples debounce a change)
+   * @param priority Task priority; keep it at or above the subscribers
+   * @return pdPASS if the task was created
+   */
+  BaseType_t begin(TickType_t period, UBaseType_t priority);
+
+  /**
+   * @brief Debounced state, one bit per button (1 = pressed)
+   */
+  uint8_t state() const { return debounced; }
+
+  static uint8_t pressed(uint32_t events) { return (uint8_t) events; }
+  static uint8_t released(uint32_t events) { return (uint8_t) (events >> 8); }
+
+private:
+  static void task(void *pvParameters);
+  uint8_t sample() const;
+
+  PortReader readPort;
+  uint8_t mask;
+  uint8_t activeLow;
+  TickType_t period;
+
+  volatile uint8_t debounced;  // 1 = pressed
+  uint8_t count0;              // Vertical counter, low bit
+  uint8_t count1;              // Vertical counter, high bit
+
+  TaskHandle_t subscribers[MAX_SUBSCRIBERS];
+  uint8_t subscriberMasks[MAX_SUBSCRIBERS];
+  uint8_t subscriberCount;
+};
+
+#endif
@@ -0,0 +1,228 @@
+#include "SchedStats.h"
+
+#if SCHED_STATS
+
+#include <Arduino.h>
+#include <string.h>
+#include <task.h>
+
+#include <HeapTrace.h>
+
+// The policy is requested through SchedTrace.h; make sure the kernel config did not override it
+#if defined(SCHED_PREEMPTION) && (configUSE_PREEMPTION != SCHED_PREEMPTION)
+#error "FreeRTOSConfig.h overrides configUSE_PREEMPTION; the requested scheduler policy is not in effect"
+#endif
+#if defined(SCHED_TIME_SLICING) && (configUSE_TIME_SLICING != SCHED_TIME_SLICING)
+#error "FreeRTOSConfig.h overrides configUSE_TIME_SLICING; the requested scheduler policy is not in effect"
+#endif
+
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME "IDLE"
+#endif
+
+struct SchedTaskStats {
+  void *tcb;
+  uint32_t readyAt;     // micros() when the task last became ready
+  uint32_t latencySum;  // Sum of ready -> running latencies in the window
+  uint32_t latencyMax;
+  uint16_t wakeups;
+  bool pending;         // Ready but not yet switched in
+};
+
+// Updated from the kernel's trace hooks, always with interrupts disabled
+static SchedTaskStats tasks[SCHED_STATS_MAX_TASKS];
+static uint8_t taskCount = 0;
+static void *idleTcb = NULL;
+static void *runningTcb = NULL;
+static uint32_t runningSince = 0;
+static uint32_t switches = 0;
+static uint32_t idleMicros = 0;
+static uint32_t busyMicros = 0;
+
+// Stands in for a running task that deleted itself, whose TCB may be reused
+static uint8_t deletedTask;
+
+/**
+ * @brief Slot of a task, allocated on first use (NULL once the table is full)
+ */
+static SchedTaskStats *FindTask(void *tcb) {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    if (tasks[i].tcb == tcb) {
+      return &tasks[i];
+    }
+  }
+
+  if (taskCount >= SCHED_STATS_MAX_TASKS) {
+    return NULL;
+  }
+
+  SchedTaskStats *slot = &tasks[taskCount++];
+  memset(slot, 0, sizeof(*slot));
+  slot->tcb = tcb;
+  return slot;
+}
+
+extern "C" void SchedStats_TaskReady(void *tcb) {
+  // Tasks created in setup() have not been woken; the rest of setup() is not latency
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+    return;
+  }
+
+  SchedTaskStats *slot = FindTask(tcb);
+  if (slot != NULL && !slot->pending) {
+    slot->readyAt = micros();
+    slot->pending = true;
+  }
+}
+
+extern "C" void SchedStats_SwitchedIn(void *tcb) {
+  if (tcb == runningTcb) {
+    return;  // Scheduler re-selected the running task: no switch
+  }
+
+  uint32_t now = micros();
+
+  // Nothing was running before the first switch (setup() is not idle time)
+  if (runningTcb != NULL) {
+    if (runningTcb == idleTcb) {
+      idleMicros += now - runningSince;
+    } else {
+      busyMicros += now - runningSince;
+    }
+  }
+  runningTcb = tcb;
+  runningSince = now;
+  switches++;
+
+  if (idleTcb == NULL && strcmp(pcTaskGetName((TaskHandle_t) tcb), configIDLE_TASK_NAME) == 0) {
+    idleTcb = tcb;
+  }
+
+  SchedTaskStats *slot = FindTask(tcb);
+  if (slot != NULL && slot->pending) {
+    uint32_t latency = now - slot->readyAt;
+    slot->pending = false;
+    slot->wakeups++;
+    slot->latencySum += latency;
+    if (latency > slot->latencyMax) {
+      slot->latencyMax = latency;
+    }
+  }
+}
+
+extern "C" void SchedStats_TaskSuspended(void *tcb) {
+  // A ready task suspended before it ran was never woken: drop the pending wake-up
+  for (uint8_t i = 0; i < taskCount; i++) {
+    if (tasks[i].tcb == tcb) {
+      tasks[i].pending = false;
+      break;
+    }
+  }
+}
+
+extern "C" void SchedStats_TaskDeleted(void *tcb) {
+  // Free the slot so report() never reads the freed TCB and a reused address starts afresh
+  for (uint8_t i = 0; i < taskCount; i++) {
+    if (tasks[i].tcb == tcb) {
+      tasks[i] = tasks[--taskCount];
+      break;
+    }
+  }
+
+  if (runningTcb == tcb) {
+    runningTcb = &deletedTask;
+  }
+}
+
+// Per-task figures copied out for printing; the name is copied too, since the
+// task may be deleted (and its TCB freed) while the report is printed
+struct SchedTaskReport {
+  char name[configMAX_TASK_NAME_LEN];
+  uint32_t latencySum;
+  uint32_t latencyMax;
+  uint16_t wakeups;
+};
+
+/**
+ * @brief Print and reset the statistics of the window that just ended
+ */
+static void Report(uint32_t windowMs) {
+  SchedTaskReport snapshot[SCHED_STATS_MAX_TASKS];
+
+  taskENTER_CRITICAL();
+  uint8_t count = taskCount;
+  for (uint8_t i = 0; i < count; i++) {
+    strncpy(snapshot[i].name, pcTaskGetName((TaskHandle_t) tasks[i].tcb), configMAX_TASK_NAME_LEN);
+    snapshot[i].name[configMAX_TASK_NAME_LEN - 1] = '\0';
+    snapshot[i].latencySum = tasks[i].latencySum;
+    snapshot[i].latencyMax = tasks[i].latencyMax;
+    snapshot[i].wakeups = tasks[i].wakeups;
+  }
+  uint32_t windowSwitches = switches;
+  uint32_t idle = idleMicros;
+  uint32_t busy = busyMicros;
+
+  switches = 0;
+  idleMicros = 0;
+  busyMicros = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    tasks[i].wakeups = 0;
+    tasks[i].latencySum = 0;
+    tasks[i].latencyMax = 0;
+  }
+  taskEXIT_CRITICAL();
+
+  Serial.println("policy,window_ms,context_switches,switches_per_s,idle_pct,busy_pct");
+  Serial.print(configUSE_PREEMPTION ? (configUSE_TIME_SLICING ? "preemptive+slicing," : "preemptive,") : "cooperative,");
+  Serial.print(windowMs);
+  Serial.print(',');
+  Serial.print(windowSwitches);
+  Serial.print(',');
+  Serial.print(windowSwitches * 1000UL / windowMs);
+  Serial.print(',');
+  Serial.print(100.0 * idle / (idle + busy), 1);
+  Serial.print(',');
+  Serial.println(100.0 * busy / (idle + busy), 1);
+
+  Serial.println("task,wakeups,avg_wake_us,max_wake_us");
+  for (uint8_t i = 0; i < count; i++) {
+    Serial.print(snapshot[i].name);
+    Serial.print(',');
+    Serial.print(snapshot[i].wakeups);
+    Serial.print(',');
+    Serial.print(snapshot[i].wakeups ? snapshot[i].latencySum / snapshot[i].wakeups : 0);
+    Serial.print(',');
+    Serial.println(snapshot[i].latencyMax);
+  }
+}
+
+/**
+ * @brief Reporter task - lowest application priority so it perturbs the demo least
+ */
+static void TaskSchedReport(void *pvParameters) {
+  (void) pvParameters;
+
+  TickType_t xLastWakeTime = xTaskGetTickCount();
+
+  while (1) {
+    vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(SCHED_STATS_REPORT_MS));
+    Report(SCHED_STATS_REPORT_MS);
+  }
+}
+
+void SchedStats_Begin() {
+  BaseType_t created = HEAP_TRACED("SchedReport", xTaskCreate(
+    TaskSchedReport,  // Task function
+    "SchedReport",    // Task name
+    320,              // Stack size (snapshot table + float formatting)
+    NULL,             // Task parameters
+    1,                // Task priority (lowest application priority)
+    NULL              // Task handle
+  ));
+
+  if (created != pdPASS) {
+    Serial.println("SchedStats: not enough heap for the report task, no statistics");
+  }
+}
+
+#endif
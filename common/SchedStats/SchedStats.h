@@ -0,0 +1,27 @@
+#ifndef SCHED_STATS_H
+#define SCHED_STATS_H
+
+#include <Arduino_FreeRTOS.h>
+
+// Scheduler statistics (enabled by the environments in ../sched_matrix.ini)
+#ifndef SCHED_STATS
+#define SCHED_STATS 0
+#endif
+
+#define SCHED_STATS_MAX_TASKS      8      // Tasks tracked for wake-up latency
+#define SCHED_STATS_REPORT_MS      10000  // Reporting window
+
+#if SCHED_STATS
+#define SCHED_STATS_BEGIN() SchedStats_Begin()
+#else
+#define SCHED_STATS_BEGIN() do {} while (0)
+#endif
+
+/**
+ * @brief Create the low-priority task that prints, every SCHED_STATS_REPORT_MS:
+ *        the scheduler policy, context switches, idle/busy split and the
+ *        wake-up latency (ready -> running) of each task. Serial must be started.
+ */
+void SchedStats_Begin();
+
+#endif
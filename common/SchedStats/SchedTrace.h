@@ -0,0 +1,57 @@
+#ifndef SCHED_TRACE_H
+#define SCHED_TRACE_H
+
+/*
+ * Force-included into every translation unit (kernel included) by the
+ * scheduler matrix environments in ../sched_matrix.ini:
+ *   -include $PROJECT_DIR/../common/SchedStats/SchedTrace.h
+ *
+ * It selects the scheduler policy before FreeRTOSConfig.h is read and routes
+ * the kernel's trace hooks to SchedStats. Must stay valid C.
+ */
+
+// Port configs set options unconditionally: read the config first (its
+// include guard makes the kernel's own #include a no-op), then override
+#if defined(__has_include)
+#if __has_include(<FreeRTOSConfig.h>)
+#include <FreeRTOSConfig.h>
+#endif
+#endif
+
+// SchedStats ignores ready-list insertions made before the scheduler starts
+#undef INCLUDE_xTaskGetSchedulerState
+#define INCLUDE_xTaskGetSchedulerState 1
+
+#if defined(SCHED_PREEMPTION)
+#undef configUSE_PREEMPTION
+#define configUSE_PREEMPTION SCHED_PREEMPTION
+#endif
+
+#if defined(SCHED_TIME_SLICING)
+#undef configUSE_TIME_SLICING
+#define configUSE_TIME_SLICING SCHED_TIME_SLICING
+#endif
+
+#ifndef __ASSEMBLER__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void SchedStats_TaskReady(void *tcb);
+void SchedStats_SwitchedIn(void *tcb);
+void SchedStats_TaskSuspended(void *tcb);
+void SchedStats_TaskDeleted(void *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB) SchedStats_TaskReady((void *) (pxTCB))
+#define traceTASK_SWITCHED_IN() SchedStats_SwitchedIn((void *) pxCurrentTCB)
+#define traceTASK_SUSPEND(pxTCB) SchedStats_TaskSuspended((void *) (pxTCB))
+#define traceTASK_DELETE(pxTCB) SchedStats_TaskDeleted((void *) (pxTCB))
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef ARDUINO_FREERTOS_CORTEXM_H
+#define ARDUINO_FREERTOS_CORTEXM_H
+
+/*
+ * The demos include the feilipu AVR port's <Arduino_FreeRTOS.h>. On Cortex-M
+ * the kernel comes from STM32duino FreeRTOS, which exposes the same FreeRTOS
+ * API (and the task.h / queue.h / semphr.h headers) through STM32FreeRTOS.h.
+ *
+ * Unlike the AVR port, it does not start the scheduler after setup(); the demos
+ * call vTaskStartScheduler() themselves on non-AVR targets.
+ */
+#include <STM32FreeRTOS.h>
+
+#if (tskKERNEL_VERSION_MAJOR < 10) || (tskKERNEL_VERSION_MAJOR == 10 && tskKERNEL_VERSION_MINOR < 4)
+/**
+ * @brief xTaskDelayUntil() for kernels before 10.4.0 (STM32duino FreeRTOS
+ *        10.3.x bundles 10.3.1), which only have vTaskDelayUntil().
+ * @return pdFALSE if the next wake time had already passed (no delay), as
+ *         10.4's xTaskDelayUntil() does. The test mirrors the kernel's, but runs just
+ *         before the call, so a tick landing in between can misreport a
+ *         borderline case.
+ */
+static inline BaseType_t xTaskDelayUntil(TickType_t *pxPreviousWakeTime, TickType_t xTimeIncrement) {
+  const TickType_t xPrevious = *pxPreviousWakeTime;
+  const TickType_t xTimeToWake = xPrevious + xTimeIncrement;
+  const TickType_t xNow = xTaskGetTickCount();
+  BaseType_t xShouldDelay;
+
+  if (xNow < xPrevious) {
+    // Tick count overflowed since the previous wake
+    xShouldDelay = (xTimeToWake < xPrevious) && (xTimeToWake > xNow);
+  } else {
+    xShouldDelay = (xTimeToWake < xPrevious) || (xTimeToWake > xNow);
+  }
+
+  vTaskDelayUntil(pxPreviousWakeTime, xTimeIncrement);
+  return xShouldDelay ? pdTRUE : pdFALSE;
+}
+#endif
+
+#endif
@@ -0,0 +1,22 @@
+#include <STM32FreeRTOS.h>
+
+#if defined(configMEMMANG_HEAP_NB) && (configMEMMANG_HEAP_NB == 5)
+
+/**
+ * @brief heap_5 allocates only from regions handed to vPortDefineHeapRegions(),
+ *        which must happen before the first pvPortMalloc(). One region of
+ *        configTOTAL_HEAP_SIZE bytes keeps the scheme comparison like-for-like
+ *        with heap_1/2/4; the constructor runs before main() and so before setup().
+ */
+static uint8_t ucHeap[configTOTAL_HEAP_SIZE] __attribute__((aligned(portBYTE_ALIGNMENT)));
+
+static const HeapRegion_t xHeapRegions[] = {
+  { ucHeap, sizeof(ucHeap) },
+  { NULL, 0 }
+};
+
+__attribute__((constructor)) static void DefineHeapRegions(void) {
+  vPortDefineHeapRegions(xHeapRegions);
+}
+
+#endif
@@ -0,0 +1,17 @@
+#if defined(QEMU_SYSCLK_HZ)
+
+#include "stm32_def.h"
+
+/**
+ * @brief Clock setup for QEMU's STM32 machines.
+ *
+ * QEMU does not model the RCC, so the variant's SystemClock_Config() would wait
+ * forever for oscillator ready flags. Keep the reset clock tree and tell HAL the
+ * fixed CPU clock the machine emulates, so SysTick and micros() run at real time.
+ */
+void SystemClock_Config(void) {
+  SystemCoreClock = QEMU_SYSCLK_HZ;
+  HAL_InitTick(TICK_INT_PRIORITY);
+}
+
+#endif